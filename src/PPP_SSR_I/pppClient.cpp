@@ -32,6 +32,7 @@
 #include "pppClient.h"
 #include "pppUtils.h"
 #include "bncephuser.h"
+#include "bncsatstatecache.h"
 #include "bncutils.h"
 
 using namespace BNC_PPP;
@@ -64,7 +65,7 @@ t_pppClient::~t_pppClient() {
 
 //
 ////////////////////////////////////////////////////////////////////////////
-void t_pppClient::processEpoch(const vector<t_satObs*>& satObs, t_output* output) {
+void t_pppClient::processEpoch(const vector<const t_satObs*>& satObs, t_output* output) {
 
   // Convert and store observations
   // ------------------------------
@@ -91,7 +92,7 @@ void t_pppClient::processEpoch(const vector<t_satObs*>& satObs, t_output* output
     satData->L5       = 0.0;
     satData->L7       = 0.0;
     for (unsigned ifrq = 0; ifrq < obs->_obs.size(); ifrq++) {
-      t_frqObs* frqObs = obs->_obs[ifrq];
+      const t_frqObs* frqObs = &obs->_obs[ifrq];
       double cb = 0.0;
       const t_satCodeBias* satCB = _pppUtils->satCodeBias(prn);
       if (satCB && satCB->_bias.size()) {
@@ -297,9 +298,8 @@ void t_pppClient::putNewObs(t_satData* satData) {
 ////////////////////////////////////////////////////////////////////////////
 void t_pppClient::putOrbCorrections(const std::vector<t_orbCorr*>& corr) {
   for (unsigned ii = 0; ii < corr.size(); ii++) {
-    QString prn = QString(corr[ii]->_prn.toInternalString().c_str());
-    t_eph* eLast = _ephUser->ephLast(prn);
-    t_eph* ePrev = _ephUser->ephPrev(prn);
+    t_eph* eLast = _ephUser->ephLast(corr[ii]->_prn);
+    t_eph* ePrev = _ephUser->ephPrev(corr[ii]->_prn);
     if      (eLast && eLast->IOD() == corr[ii]->_iod) {
       eLast->setOrbCorr(corr[ii]);
     }
@@ -313,9 +313,8 @@ void t_pppClient::putOrbCorrections(const std::vector<t_orbCorr*>& corr) {
 ////////////////////////////////////////////////////////////////////////////
 void t_pppClient::putClkCorrections(const std::vector<t_clkCorr*>& corr) {
   for (unsigned ii = 0; ii < corr.size(); ii++) {
-    QString prn = QString(corr[ii]->_prn.toInternalString().c_str());
-    t_eph* eLast = _ephUser->ephLast(prn);
-    t_eph* ePrev = _ephUser->ephPrev(prn);
+    t_eph* eLast = _ephUser->ephLast(corr[ii]->_prn);
+    t_eph* ePrev = _ephUser->ephPrev(corr[ii]->_prn);
     if      (eLast && eLast->IOD() == corr[ii]->_iod) {
       eLast->setClkCorr(corr[ii]);
     }
@@ -377,12 +376,13 @@ void t_pppClient::putEphemeris(const t_eph* eph) {
 t_irc t_pppClient::getSatPos(const bncTime& tt, const QString& prn,
                               NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& vv) {
 
+  bncSatStateCache* cache = bncSatStateCache::instance();
   t_eph* eLast = _ephUser->ephLast(prn);
   t_eph* ePrev = _ephUser->ephPrev(prn);
-  if      (eLast && eLast->getCrd(tt, xc, vv, _opt->useOrbClkCorr()) == success) {
+  if      (eLast && cache->getCrd(eLast, tt, xc, vv, _opt->useOrbClkCorr()) == success) {
     return success;
   }
-  else if (ePrev && ePrev->getCrd(tt, xc, vv, _opt->useOrbClkCorr()) == success) {
+  else if (ePrev && cache->getCrd(ePrev, tt, xc, vv, _opt->useOrbClkCorr()) == success) {
     return success;
   }
   return failure;
@@ -412,8 +412,10 @@ t_irc t_pppClient::cmpToT(t_satData* satData) {
     clkSat = xc(4);
 
     if ( fabs(clkSat-clkSatOld) * t_CST::c < 1.e-4 ) {
-      satData->xx      = xc.Rows(1,3);
-      satData->vv      = vv;
+      for (int ii = 0; ii < 3; ii++) {
+        satData->xx[ii] = xc(ii+1);
+        satData->vv[ii] = vv(ii+1);
+      }
       satData->clk     = clkSat * t_CST::c;
       return success;
     }
@@ -44,7 +44,7 @@ class t_pppClient : public interface_pppClient {
  public:
   t_pppClient(const t_pppOptions* opt);
   ~t_pppClient();
-  void                processEpoch(const std::vector<t_satObs*>& satObs, t_output* output);
+  void                processEpoch(const std::vector<const t_satObs*>& satObs, t_output* output);
   void                putEphemeris(const t_eph* eph);
   void                putTec(const t_vTec* vTec);
   void                putOrbCorrections(const std::vector<t_orbCorr*>& corr);
@@ -53,6 +53,7 @@ class t_pppClient : public interface_pppClient {
   void                putPhaseBiases(const std::vector<t_satPhaseBias*>& satPhaseBias);
   std::ostringstream& log() {return *_log;}
   const t_pppOptions* opt() const {return _opt;}
+  t_pppSmoother*      smoother() {return _filter->smoother();}
   void                reset();
 
  private:
@@ -32,6 +32,7 @@
 
 #include "pppFilter.h"
 #include "pppClient.h"
+#include "pppSmoother.h"
 #include "bncutils.h"
 #include "bncantex.h"
 #include "pppOptions.h"
@@ -78,13 +79,13 @@ double t_pppParam::partial(t_satData* satData, bool phase) {
   // Coordinates
   // -----------
   if      (type == CRD_X) {
-    return (xx - satData->xx(1)) / satData->rho;
+    return (xx - satData->xx[0]) / satData->rho;
   }
   else if (type == CRD_Y) {
-    return (xx - satData->xx(2)) / satData->rho;
+    return (xx - satData->xx[1]) / satData->rho;
   }
   else if (type == CRD_Z) {
-    return (xx - satData->xx(3)) / satData->rho;
+    return (xx - satData->xx[2]) / satData->rho;
   }
 
   // Receiver Clocks
@@ -157,9 +158,13 @@ t_pppFilter::t_pppFilter(t_pppClient* pppClient) {
 
   // Antenna Name, ANTEX File
   // ------------------------
-  _antex = 0;
   if (!OPT->_antexFileName.empty()) {
-    _antex = new bncAntex(OPT->_antexFileName.c_str());
+    _antex = bncAntex::shared(OPT->_antexFileName.c_str());
+  }
+  if (_antex) {
+    for (int iFrq = 0; iFrq < t_frequency::max; iFrq++) {
+      _pcvHandle[iFrq] = _antex->rcvHandle(OPT->_antNameRover, t_frequency::type(iFrq));
+    }
   }
 
   // Bancroft Coordinates
@@ -176,13 +181,24 @@ t_pppFilter::t_pppFilter(t_pppClient* pppClient) {
   _neu.ReSize(3); _neu = 0.0;
   _numSat = 0;
   _hDop   = 0.0;
+
+  // Filter Update Backend
+  // ---------------------
+  _kalman.setBackend(t_pppKalman::backend(OPT->_filter));
+
+  // Backward Smoothing (post-processing only)
+  // -----------------------------------------
+  _smoother = 0;
+  _newArc   = false;
+  if (OPT->_smoothing && !OPT->_realTime) {
+    _smoother = new t_pppSmoother();
+  }
 }
 
 // Destructor
 ////////////////////////////////////////////////////////////////////////////
 t_pppFilter::~t_pppFilter() {
   delete _tides;
-  delete _antex;
   for (int iPar = 1; iPar <= _params.size(); iPar++) {
     delete _params[iPar-1];
   }
@@ -190,6 +206,7 @@ t_pppFilter::~t_pppFilter() {
     delete _params_sav[iPar-1];
   }
   delete _epoData_sav;
+  delete _smoother;
 }
 
 // Reset Parameters and Variance-Covariance Matrix
@@ -274,9 +291,9 @@ t_irc t_pppFilter::cmpBancroft(t_epoData* epoData) {
     if (satData->system() == 'G') {
       ++iObsBanc;
       QString    prn     = it.key();
-      BB(iObsBanc, 1) = satData->xx(1);
-      BB(iObsBanc, 2) = satData->xx(2);
-      BB(iObsBanc, 3) = satData->xx(3);
+      BB(iObsBanc, 1) = satData->xx[0];
+      BB(iObsBanc, 2) = satData->xx[1];
+      BB(iObsBanc, 3) = satData->xx[2];
       BB(iObsBanc, 4) = satData->P3 + satData->clk;
     }
   }
@@ -316,21 +333,23 @@ double t_pppFilter::cmpValue(t_satData* satData, bool phase) {
 
   Tracer tracer("t_pppFilter::cmpValue");
 
-  ColumnVector xRec(3);
-  xRec(1) = x();
-  xRec(2) = y();
-  xRec(3) = z();
+  const double* xSat = satData->xx;
 
-  double rho0 = (satData->xx - xRec).NormFrobenius();
+  double rho0 = sqrt((xSat[0]-x())*(xSat[0]-x()) +
+                     (xSat[1]-y())*(xSat[1]-y()) +
+                     (xSat[2]-z())*(xSat[2]-z()));
   double dPhi = t_CST::omega * rho0 / t_CST::c;
 
+  ColumnVector xRec(3);
   xRec(1) = x() * cos(dPhi) - y() * sin(dPhi);
   xRec(2) = y() * cos(dPhi) + x() * sin(dPhi);
   xRec(3) = z();
 
   xRec += _tides->displacement(_time, xRec);
 
-  satData->rho = (satData->xx - xRec).NormFrobenius();
+  satData->rho = sqrt((xSat[0]-xRec(1))*(xSat[0]-xRec(1)) +
+                      (xSat[1]-xRec(2))*(xSat[1]-xRec(2)) +
+                      (xSat[2]-xRec(3))*(xSat[2]-xRec(3)));
 
   double tropDelay = delay_saast(satData->eleSat) +
                      trp() / sin(satData->eleSat);
@@ -360,14 +379,11 @@ double t_pppFilter::cmpValue(t_satData* satData, bool phase) {
   }
   double phaseCenter = 0.0;
   if (_antex) {
-    bool found;
-    phaseCenter = satData->lkA * _antex->rcvCorr(OPT->_antNameRover, frqA,
-                                                 satData->eleSat, satData->azSat,
-                                                 found)
-                + satData->lkB * _antex->rcvCorr(OPT->_antNameRover, frqB,
-                                                 satData->eleSat, satData->azSat,
-                                                 found);
-    if (!found) {
+    const bncAntex::t_pcvHandle& pcvA = _pcvHandle[frqA];
+    const bncAntex::t_pcvHandle& pcvB = _pcvHandle[frqB];
+    phaseCenter = satData->lkA * _antex->rcvCorr(pcvA, satData->eleSat, satData->azSat)
+                + satData->lkB * _antex->rcvCorr(pcvB, satData->eleSat, satData->azSat);
+    if (!pcvB.found()) {
       LOG << "ANTEX: antenna >" << OPT->_antNameRover << "< not found\n";
     }
   }
@@ -442,6 +458,7 @@ void t_pppFilter::predict(int iPhase, t_epoData* epoData) {
       _startTime = epoData->tt;
       reset();
     }
+    _newArc = firstCrd;
 
     // Use different white noise for Quick-Start mode
     // ----------------------------------------------
@@ -622,6 +639,10 @@ t_irc t_pppFilter::update(t_epoData* epoData) {
     return failure;
   }
 
+  if (_smoother) {
+    _smoother->putFiltered(_time, _params, _QQ, delay_saast(M_PI/2.0));
+  }
+
   // Set Solution Vector
   // -------------------
   LOG.setf(ios::fixed);
@@ -738,7 +759,7 @@ t_irc t_pppFilter::update(t_epoData* epoData) {
 
 // Outlier Detection
 ////////////////////////////////////////////////////////////////////////////
-QString t_pppFilter::outlierDetection(int iPhase, const ColumnVector& vv,
+QString t_pppFilter::outlierDetection(int iPhase, const t_pppKalman& kalman,
                                       QMap<QString, t_satData*>& satData) {
 
   Tracer tracer("t_pppFilter::outlierDetection");
@@ -747,7 +768,7 @@ QString t_pppFilter::outlierDetection(int iPhase, const ColumnVector& vv,
   QString prnGlo;
   double  maxResGPS = 0.0; // GPS + Galileo
   double  maxResGlo = 0.0; // GLONASS + BDS
-  findMaxRes(vv, satData, prnGPS, prnGlo, maxResGPS, maxResGlo);
+  findMaxRes(kalman, satData, prnGPS, prnGlo, maxResGPS, maxResGlo);
 
   if      (iPhase == 1) {
     if      (maxResGlo > 2.98 * OPT->_maxResL1) {
@@ -769,7 +790,7 @@ QString t_pppFilter::outlierDetection(int iPhase, const ColumnVector& vv,
 
 // Phase Wind-Up Correction
 ///////////////////////////////////////////////////////////////////////////
-double t_pppFilter::windUp(const QString& prn, const ColumnVector& rSat,
+double t_pppFilter::windUp(const QString& prn, const double* xSat,
                         const ColumnVector& rRec) {
 
   Tracer tracer("t_pppFilter::windUp");
@@ -789,6 +810,11 @@ double t_pppFilter::windUp(const QString& prn, const ColumnVector& rSat,
 
     // Unit Vector GPS Satellite --> Receiver
     // --------------------------------------
+    ColumnVector rSat(3);
+    rSat(1) = xSat[0];
+    rSat(2) = xSat[1];
+    rSat(3) = xSat[2];
+
     ColumnVector rho = rRec - rSat;
     rho /= rho.NormFrobenius();
 
@@ -857,7 +883,10 @@ double t_pppFilter::windUp(const QString& prn, const ColumnVector& rSat,
 ///////////////////////////////////////////////////////////////////////////
 void t_pppFilter::cmpEle(t_satData* satData) {
   Tracer tracer("t_pppFilter::cmpEle");
-  ColumnVector rr = satData->xx - _xcBanc.Rows(1,3);
+  ColumnVector rr(3);
+  rr(1) = satData->xx[0] - _xcBanc(1);
+  rr(2) = satData->xx[1] - _xcBanc(2);
+  rr(3) = satData->xx[2] - _xcBanc(3);
   double       rho = rr.NormFrobenius();
 
   //double neu[3];
@@ -897,8 +926,7 @@ void t_pppFilter::addAmb(t_satData* satData) {
 
 //
 ///////////////////////////////////////////////////////////////////////////
-void t_pppFilter::addObs(int iPhase, unsigned& iObs, t_satData* satData,
-                      Matrix& AA, ColumnVector& ll, DiagonalMatrix& PP) {
+void t_pppFilter::addObs(int iPhase, unsigned& iObs, t_satData* satData) {
 
   Tracer tracer("t_pppFilter::addObs");
 
@@ -918,7 +946,7 @@ void t_pppFilter::addObs(int iPhase, unsigned& iObs, t_satData* satData,
   // ------------------
 
   if (iPhase == 1) {
-    ll(iObs)      = satData->L3 - cmpValue(satData, true);
+    _kalman.ll(iObs) = satData->L3 - cmpValue(satData, true);
     double sigL3 = 2.98 * OPT->_sigmaL1;
     if (satData->system() == 'R') {
       sigL3 *= GLONASS_WEIGHT_FACTOR;
@@ -926,13 +954,13 @@ void t_pppFilter::addObs(int iPhase, unsigned& iObs, t_satData* satData,
     if  (satData->system() == 'C') {
       sigL3 *= BDS_WEIGHT_FACTOR;
     }
-    PP(iObs,iObs) = 1.0 / (sigL3 * sigL3) / (ellWgtCoef * ellWgtCoef);
+    _kalman.PP(iObs) = 1.0 / (sigL3 * sigL3) / (ellWgtCoef * ellWgtCoef);
     for (int iPar = 1; iPar <= _params.size(); iPar++) {
       if (_params[iPar-1]->type == t_pppParam::AMB_L3 &&
           _params[iPar-1]->prn  == satData->prn) {
-        ll(iObs) -= _params[iPar-1]->xx;
+        _kalman.ll(iObs) -= _params[iPar-1]->xx;
       }
-      AA(iObs, iPar) = _params[iPar-1]->partial(satData, true);
+      _kalman.AA(iObs, iPar) = _params[iPar-1]->partial(satData, true);
     }
   }
 
@@ -940,17 +968,17 @@ void t_pppFilter::addObs(int iPhase, unsigned& iObs, t_satData* satData,
   // -----------------
   else {
     double sigP3 = 2.98 * OPT->_sigmaC1;
-    ll(iObs)      = satData->P3 - cmpValue(satData, false);
-    PP(iObs,iObs) = 1.0 / (sigP3 * sigP3) / (ellWgtCoef * ellWgtCoef);
+    _kalman.ll(iObs) = satData->P3 - cmpValue(satData, false);
+    _kalman.PP(iObs) = 1.0 / (sigP3 * sigP3) / (ellWgtCoef * ellWgtCoef);
     for (int iPar = 1; iPar <= _params.size(); iPar++) {
-      AA(iObs, iPar) = _params[iPar-1]->partial(satData, false);
+      _kalman.AA(iObs, iPar) = _params[iPar-1]->partial(satData, false);
     }
   }
 }
 
 //
 ///////////////////////////////////////////////////////////////////////////
-QByteArray t_pppFilter::printRes(int iPhase, const ColumnVector& vv,
+QByteArray t_pppFilter::printRes(int iPhase, const t_pppKalman& kalman,
                               const QMap<QString, t_satData*>& satDataMap) {
 
   Tracer tracer("t_pppFilter::printRes");
@@ -968,7 +996,7 @@ QByteArray t_pppFilter::printRes(int iPhase, const ColumnVector& vv,
       str << _time.datestr() << "_" << _time.timestr(3)
           << " RES " << satData->prn.mid(0,3).toLatin1().data()
           << (iPhase ? "   L3 " : "   P3 ")
-          << setw(9) << setprecision(4) << vv(satData->obsIndex) << endl;
+          << setw(9) << setprecision(4) << kalman.vv(satData->obsIndex) << endl;
     }
   }
 
@@ -977,7 +1005,7 @@ QByteArray t_pppFilter::printRes(int iPhase, const ColumnVector& vv,
 
 //
 ///////////////////////////////////////////////////////////////////////////
-void t_pppFilter::findMaxRes(const ColumnVector& vv,
+void t_pppFilter::findMaxRes(const t_pppKalman& kalman,
                           const QMap<QString, t_satData*>& satData,
                           QString& prnGPS, QString& prnGlo,
                           double& maxResGPS, double& maxResGlo) {
@@ -993,15 +1021,16 @@ void t_pppFilter::findMaxRes(const ColumnVector& vv,
     t_satData* satData = it.value();
     if (satData->obsIndex != 0) {
       QString prn = satData->prn;
+      double  res = fabs(kalman.vv(satData->obsIndex));
       if (prn[0] == 'R' || prn[0] == 'C') {
-        if (fabs(vv(satData->obsIndex)) > maxResGlo) {
-          maxResGlo = fabs(vv(satData->obsIndex));
+        if (res > maxResGlo) {
+          maxResGlo = res;
           prnGlo    = prn;
         }
       }
       else {
-        if (fabs(vv(satData->obsIndex)) > maxResGPS) {
-          maxResGPS = fabs(vv(satData->obsIndex));
+        if (res > maxResGPS) {
+          maxResGPS = res;
           prnGPS    = prn;
         }
       }
@@ -1021,6 +1050,11 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
 
   QString lastOutlierPrn;
 
+  // Outliers are either removed from the completed update (downdate) or
+  // the whole epoch is solved again without the offending satellite
+  // --------------------------------------------------------------------
+  bool downdate = (OPT->_outlierMode == "downdate");
+
   // Try with all satellites, then with all minus one, etc.
   // ------------------------------------------------------
   while (selectSatellites(lastOutlierPrn, epoData->satData) == success) {
@@ -1078,9 +1112,7 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
 
       // Prepare first-design Matrix, vector observed-computed
       // -----------------------------------------------------
-      Matrix          AA(nObs, nPar);  // first design matrix
-      ColumnVector    ll(nObs);        // terms observed-computed
-      DiagonalMatrix  PP(nObs); PP = 0.0;
+      _kalman.resize(nObs, nPar);
 
       unsigned iObs = 0;
       QMapIterator<QString, t_satData*> it(epoData->satData);
@@ -1092,7 +1124,7 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
         (iPhase == 0) ? useObs = OPT->codeLCs(satData->system()).size() :
                         useObs = OPT->ambLCs(satData->system()).size();
         if (useObs) {
-          addObs(iPhase, iObs, satData, AA, ll, PP);
+          addObs(iPhase, iObs, satData);
         } else {
           satData->obsIndex = 0;
         }
@@ -1100,23 +1132,58 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
 
       // Compute Filter Update
       // ---------------------
-      ColumnVector dx(nPar); dx = 0.0;
-      kalman(AA, ll, PP, _QQ, dx);
-      ColumnVector vv = ll - AA * dx;
+      if (_smoother && iPhase == 0) {
+        _smoother->putPredicted(_params, _QQ, _newArc);
+      }
+
+      QElapsedTimer timer;
+      timer.start();
+      _kalman.update(_QQ);
+      if (OPT->_filterTiming || _kalman.backend() != t_pppKalman::QR) {
+        LOG.setf(ios::fixed);
+        LOG << _time.datestr() << "_" << _time.timestr(3)
+            << " FILTER " << t_pppKalman::backendName(_kalman.backend())
+            << (iPhase ? " L3 " : " P3 ") << setw(3) << nObs << ' ' << setw(3) << nPar << ' '
+            << setw(8) << setprecision(3) << timer.nsecsElapsed() / 1.e6 << " ms" << endl;
+      }
+
+      // Check the residuals
+      // -------------------
+      lastOutlierPrn = outlierDetection(iPhase, _kalman, epoData->satData);
+
+      // Remove outliers one by one from the update (downdate mode)
+      // ----------------------------------------------------------
+      // (if the downdate fails, the epoch is solved again from scratch with
+      //  the default outlier handling)
+      // --------------------------------------------------------------------
+      QStringList rejectedPrns;
+      bool        fromScratch = false;
+      while (downdate && !lastOutlierPrn.isEmpty()) {
+        if (rejectObs(lastOutlierPrn, epoData) != success) {
+          LOG << _time.datestr() << "_" << _time.timestr(3)
+              << " downdate failed, outliers resolved from scratch" << endl;
+          downdate    = false;
+          fromScratch = true;
+          lastOutlierPrn.clear();
+          break;
+        }
+        rejectedPrns << lastOutlierPrn;
+        lastOutlierPrn = outlierDetection(iPhase, _kalman, epoData->satData);
+      }
+      if (fromScratch) {
+        restoreState(epoData);
+        break;
+      }
 
       // Print Residuals
       // ---------------
       if (iPhase == 0) {
-        strResCode  = printRes(iPhase, vv, epoData->satData);
+        strResCode  = printRes(iPhase, _kalman, epoData->satData);
       }
       else {
-        strResPhase = printRes(iPhase, vv, epoData->satData);
+        strResPhase = printRes(iPhase, _kalman, epoData->satData);
       }
 
-      // Check the residuals
-      // -------------------
-      lastOutlierPrn = outlierDetection(iPhase, vv, epoData->satData);
-
       // No Outlier Detected
       // -------------------
       if (lastOutlierPrn.isEmpty()) {
@@ -1124,13 +1191,24 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
         QVectorIterator<t_pppParam*> itPar(_params);
         while (itPar.hasNext()) {
           t_pppParam* par = itPar.next();
-          par->xx += dx(par->index);
+          par->xx += _kalman.dx(par->index);
+        }
+
+        if (!rejectedPrns.isEmpty()) {
+          removeSatellites(rejectedPrns, epoData);
         }
 
         if (!usePhase || iPhase == 1) {
           if (_outlierGPS.size() > 0 || _outlierGlo.size() > 0) {
             LOG << "Neglected PRNs: ";
-            if (!_outlierGPS.isEmpty()) {
+            if (downdate) {
+              QStringListIterator itGPS(_outlierGPS);
+              while (itGPS.hasNext()) {
+                QString prn = itGPS.next();
+                LOG << prn.mid(0,3).toLatin1().data() << ' ';
+              }
+            }
+            else if (!_outlierGPS.isEmpty()) {
               LOG << _outlierGPS.last().mid(0,3).toLatin1().data() << ' ';
             }
             QStringListIterator itGlo(_outlierGlo);
@@ -1161,6 +1239,76 @@ t_irc t_pppFilter::update_p(t_epoData* epoData) {
   return failure;
 }
 
+// Remove the observation of an outlier satellite from the filter update
+////////////////////////////////////////////////////////////////////////////
+t_irc t_pppFilter::rejectObs(const QString& prn, t_epoData* epoData) {
+
+  Tracer tracer("t_pppFilter::rejectObs");
+
+  t_satData* satData = epoData->satData.value(prn);
+  if (!satData || satData->obsIndex == 0) {
+    return failure;
+  }
+
+  if (_kalman.downdate(satData->obsIndex, _QQ) != success) {
+    return failure;
+  }
+  satData->obsIndex = 0;
+
+  if (prn[0] == 'R' || prn[0] == 'C') {
+    _outlierGlo << prn;
+  }
+  else {
+    _outlierGPS << prn;
+  }
+
+  if (int(_kalman.nObsUsed()) < OPT->_minObs) {
+    return failure;
+  }
+
+  return success;
+}
+
+// Remove satellites and their ambiguity parameters (marginalization)
+////////////////////////////////////////////////////////////////////////////
+void t_pppFilter::removeSatellites(const QStringList& prns, t_epoData* epoData) {
+
+  Tracer tracer("t_pppFilter::removeSatellites");
+
+  QStringListIterator itPrn(prns);
+  while (itPrn.hasNext()) {
+    QString prn = itPrn.next();
+    if (epoData->satData.contains(prn)) {
+      delete epoData->satData.take(prn);
+    }
+  }
+
+  QVector<int> indexKept;
+  QMutableVectorIterator<t_pppParam*> im(_params);
+  while (im.hasNext()) {
+    t_pppParam* par = im.next();
+    if (par->type == t_pppParam::AMB_L3 && prns.contains(par->prn)) {
+      delete par;
+      im.remove();
+    }
+    else {
+      indexKept << par->index;
+      par->index     = indexKept.size();
+      par->index_old = par->index;
+    }
+  }
+
+  if (indexKept.size() != _QQ.Nrows()) {
+    SymmetricMatrix QQ_old = _QQ;
+    _QQ.ReSize(indexKept.size());
+    for (int i1 = 1; i1 <= indexKept.size(); i1++) {
+      for (int i2 = 1; i2 <= i1; i2++) {
+        _QQ(i1, i2) = QQ_old(indexKept[i1-1], indexKept[i2-1]);
+      }
+    }
+  }
+}
+
 // Remeber Original State Vector and Variance-Covariance Matrix
 ////////////////////////////////////////////////////////////////////////////
 void t_pppFilter::rememberState(t_epoData* epoData) {
@@ -31,8 +31,8 @@
 
 #include "bncconst.h"
 #include "bnctime.h"
-
-class bncAntex;
+#include "bncantex.h"
+#include "pppKalman.h"
 
 namespace BNC_PPP {
 
@@ -41,6 +41,7 @@ class t_pppOptions;
 class t_epoData;
 class t_satData;
 class t_tides;
+class t_pppSmoother;
 
 class t_satData {
  public:
@@ -64,6 +65,10 @@ class t_satData {
     rho      = 0.0;
     slipFlag = false;
     lambda3  = 0.0;
+    for (unsigned ii = 0; ii < 3; ii++) {
+      xx[ii] = 0.0;
+      vv[ii] = 0.0;
+    }
   }
   ~t_satData() {}
   bncTime      tt;
@@ -78,8 +83,8 @@ class t_satData {
   double       L5;
   double       L7;
   double       L3;
-  NEWMAT::ColumnVector xx;
-  NEWMAT::ColumnVector vv;
+  double       xx[3];
+  double       vv[3];
   double       clk;
   double       eleSat;
   double       azSat;
@@ -165,6 +170,7 @@ class t_pppFilter {
   const NEWMAT::ColumnVector& neu() const {return _neu;}
   int    numSat() const {return _numSat;}
   double HDOP()   const {return _hDop;}
+  t_pppSmoother* smoother() {return _smoother;}
   double x()      const {return _params[0]->xx;}
   double y()      const {return _params[1]->xx;}
   double z()      const {return _params[2]->xx;}
@@ -221,11 +227,10 @@ class t_pppFilter {
   t_irc  cmpBancroft(t_epoData* epoData);
   void   cmpEle(t_satData* satData);
   void   addAmb(t_satData* satData);
-  void   addObs(int iPhase, unsigned& iObs, t_satData* satData,
-                NEWMAT::Matrix& AA, NEWMAT::ColumnVector& ll, NEWMAT::DiagonalMatrix& PP);
-  QByteArray printRes(int iPhase, const NEWMAT::ColumnVector& vv,
+  void   addObs(int iPhase, unsigned& iObs, t_satData* satData);
+  QByteArray printRes(int iPhase, const t_pppKalman& kalman,
                       const QMap<QString, t_satData*>& satDataMap);
-  void   findMaxRes(const NEWMAT::ColumnVector& vv,
+  void   findMaxRes(const t_pppKalman& kalman,
                     const QMap<QString, t_satData*>& satData,
                     QString& prnGPS, QString& prnGlo,
                     double& maxResGPS, double& maxResGlo);
@@ -233,10 +238,10 @@ class t_pppFilter {
   double delay_saast(double Ele);
   void   predict(int iPhase, t_epoData* epoData);
   t_irc  update_p(t_epoData* epoData);
-  QString outlierDetection(int iPhase, const NEWMAT::ColumnVector& vv,
+  QString outlierDetection(int iPhase, const t_pppKalman& kalman,
                            QMap<QString, t_satData*>& satData);
 
-  double windUp(const QString& prn, const NEWMAT::ColumnVector& rSat,
+  double windUp(const QString& prn, const double* xSat,
                 const NEWMAT::ColumnVector& rRec);
 
   bncTime  _startTime;
@@ -246,6 +251,8 @@ class t_pppFilter {
 
   t_irc selectSatellites(const QString& lastOutlierPrn,
                          QMap<QString, t_satData*>& satData);
+  t_irc rejectObs(const QString& prn, t_epoData* epoData);
+  void  removeSatellites(const QStringList& prns, t_epoData* epoData);
 
   void bancroft(const NEWMAT::Matrix& BBpass, NEWMAT::ColumnVector& pos);
 
@@ -265,8 +272,12 @@ class t_pppFilter {
   QMap<QString, double> _windUpSum;
   QStringList           _outlierGPS;
   QStringList           _outlierGlo;
-  bncAntex*             _antex;
+  QSharedPointer<const bncAntex> _antex;
+  bncAntex::t_pcvHandle _pcvHandle[t_frequency::max];
   t_tides*              _tides;
+  t_pppKalman           _kalman;
+  t_pppSmoother*        _smoother;
+  bool                  _newArc;
   NEWMAT::ColumnVector  _neu;
   int                   _numSat;
   double                _hDop;
@@ -0,0 +1,250 @@
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      t_pppKalman
+ *
+ * Purpose:    Allocation-free measurement update of the PPP filter
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include "pppKalman.h"
+#include "bncutils.h"
+
+using namespace BNC_PPP;
+using namespace std;
+using namespace NEWMAT;
+
+// Index of element (a,b), a >= b, 0-based, in the packed lower triangle
+////////////////////////////////////////////////////////////////////////////
+static inline unsigned packed(unsigned a, unsigned b) {
+  return (a >= b) ? a*(a+1)/2 + b : b*(b+1)/2 + a;
+}
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_pppKalman::t_pppKalman() {
+  _backend = QR;
+  _nObs    = 0;
+  _nPar    = 0;
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+t_pppKalman::~t_pppKalman() {
+}
+
+// Backend from option string (QR is the default)
+////////////////////////////////////////////////////////////////////////////
+t_pppKalman::t_backend t_pppKalman::backend(const string& name) {
+  if (name == "Joseph") {
+    return Joseph;
+  }
+  return QR;
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+const char* t_pppKalman::backendName(t_backend backend) {
+  return (backend == Joseph) ? "Joseph" : "QR";
+}
+
+// Set dimensions, reuse storage (reallocates only if a dimension grows)
+////////////////////////////////////////////////////////////////////////////
+void t_pppKalman::resize(unsigned nObs, unsigned nPar) {
+  _nObs = nObs;
+  _nPar = nPar;
+  _AA.assign(nObs*nPar, 0.0);
+  _ll.assign(nObs, 0.0);
+  _PP.assign(nObs, 0.0);
+  _vv.assign(nObs, 0.0);
+  _dx.assign(nPar, 0.0);
+  _uu.assign(nPar, 0.0);
+  _kk.assign(nPar, 0.0);
+  if (_nonZero.capacity() < nPar) {
+    _nonZero.reserve(nPar);
+  }
+}
+
+// Filter update, QQ is updated, state increments dx and residuals vv
+// are available afterwards
+////////////////////////////////////////////////////////////////////////////
+void t_pppKalman::update(SymmetricMatrix& QQ) {
+
+  Tracer tracer("t_pppKalman::update");
+
+  if (_backend == Joseph) {
+    updateJoseph(QQ);
+  }
+  else {
+    updateQR(QQ);
+  }
+
+  cmpResiduals();
+}
+
+// Remove observation iObs (1-based) from the completed update
+//
+//   u = Q h',  c = 1/p - h u  (variance of the residual v)
+//   Q <- Q + u u' / c,  dx <- dx - u v / c
+////////////////////////////////////////////////////////////////////////////
+t_irc t_pppKalman::downdate(unsigned iObs, SymmetricMatrix& QQ) {
+
+  Tracer tracer("t_pppKalman::downdate");
+
+  if (iObs < 1 || iObs > _nObs || _PP[iObs-1] <= 0.0) {
+    return failure;
+  }
+
+  double*       qq = QQ.Store();
+  const double* hh = &_AA[(iObs-1)*_nPar];
+
+  for (unsigned aa = 0; aa < _nPar; aa++) {
+    double uu = 0.0;
+    for (unsigned bb = 0; bb < _nPar; bb++) {
+      if (hh[bb] != 0.0) {
+        uu += qq[packed(aa, bb)] * hh[bb];
+      }
+    }
+    _uu[aa] = uu;
+  }
+
+  double sig2 = 1.0 / _PP[iObs-1];
+  double cc   = sig2;
+  for (unsigned bb = 0; bb < _nPar; bb++) {
+    cc -= hh[bb] * _uu[bb];
+  }
+
+  // Observation alone determines a parameter - cannot be removed
+  // ------------------------------------------------------------
+  if (cc <= 1.e-10 * sig2) {
+    return failure;
+  }
+
+  double vv = _vv[iObs-1];
+  for (unsigned aa = 0; aa < _nPar; aa++) {
+    _dx[aa] -= _uu[aa] * vv / cc;
+  }
+
+  double* qa = qq;
+  for (unsigned aa = 0; aa < _nPar; aa++) {
+    for (unsigned bb = 0; bb <= aa; bb++) {
+      qa[bb] += _uu[aa] * _uu[bb] / cc;
+    }
+    qa += aa + 1;
+  }
+
+  _PP[iObs-1] = 0.0;
+
+  cmpResiduals();
+
+  return success;
+}
+
+// Number of observations not removed by downdate
+////////////////////////////////////////////////////////////////////////////
+unsigned t_pppKalman::nObsUsed() const {
+  unsigned nUsed = 0;
+  for (unsigned iObs = 0; iObs < _nObs; iObs++) {
+    if (_PP[iObs] > 0.0) {
+      ++nUsed;
+    }
+  }
+  return nUsed;
+}
+
+// Residuals v = l - A dx
+////////////////////////////////////////////////////////////////////////////
+void t_pppKalman::cmpResiduals() {
+  for (unsigned iObs = 0; iObs < _nObs; iObs++) {
+    const double* hh = &_AA[iObs*_nPar];
+    double vv = _ll[iObs];
+    for (unsigned iPar = 0; iPar < _nPar; iPar++) {
+      vv -= hh[iPar] * _dx[iPar];
+    }
+    _vv[iObs] = vv;
+  }
+}
+
+// Square-root covariance update (reference implementation)
+////////////////////////////////////////////////////////////////////////////
+void t_pppKalman::updateQR(SymmetricMatrix& QQ) {
+
+  Matrix         AA(_nObs, _nPar);
+  ColumnVector   ll(_nObs);
+  DiagonalMatrix PP(_nObs);
+  for (unsigned iObs = 1; iObs <= _nObs; iObs++) {
+    ll(iObs) = _ll[iObs-1];
+    PP(iObs) = _PP[iObs-1];
+    for (unsigned iPar = 1; iPar <= _nPar; iPar++) {
+      AA(iObs, iPar) = _AA[(iObs-1)*_nPar + iPar-1];
+    }
+  }
+
+  ColumnVector dx(_nPar); dx = 0.0;
+  kalman(AA, ll, PP, QQ, dx);
+
+  for (unsigned iPar = 1; iPar <= _nPar; iPar++) {
+    _dx[iPar-1] = dx(iPar);
+  }
+}
+
+// Sequential scalar updates in place on the packed covariance matrix
+//
+//   u = Q h',  s = h u + 1/p,  k = u / s
+//   Q <- (I - k h) Q (I - k h)' + k k' / p = Q - k u' - u k' + s k k'
+////////////////////////////////////////////////////////////////////////////
+void t_pppKalman::updateJoseph(SymmetricMatrix& QQ) {
+
+  double* qq = QQ.Store();
+
+  for (unsigned iObs = 0; iObs < _nObs; iObs++) {
+    const double* hh = &_AA[iObs*_nPar];
+
+    _nonZero.clear();
+    for (unsigned iPar = 0; iPar < _nPar; iPar++) {
+      if (hh[iPar] != 0.0) {
+        _nonZero.push_back(iPar);
+      }
+    }
+    if (_nonZero.empty() || _PP[iObs] <= 0.0) {
+      continue;
+    }
+
+    double innov = _ll[iObs];
+    for (unsigned ii = 0; ii < _nonZero.size(); ii++) {
+      innov -= hh[_nonZero[ii]] * _dx[_nonZero[ii]];
+    }
+
+    for (unsigned aa = 0; aa < _nPar; aa++) {
+      double uu = 0.0;
+      for (unsigned ii = 0; ii < _nonZero.size(); ii++) {
+        unsigned bb = _nonZero[ii];
+        uu += qq[packed(aa, bb)] * hh[bb];
+      }
+      _uu[aa] = uu;
+    }
+
+    double ss = 1.0 / _PP[iObs];
+    for (unsigned ii = 0; ii < _nonZero.size(); ii++) {
+      ss += hh[_nonZero[ii]] * _uu[_nonZero[ii]];
+    }
+
+    for (unsigned aa = 0; aa < _nPar; aa++) {
+      _kk[aa]  = _uu[aa] / ss;
+      _dx[aa] += _kk[aa] * innov;
+    }
+
+    double* qa = qq;
+    for (unsigned aa = 0; aa < _nPar; aa++) {
+      for (unsigned bb = 0; bb <= aa; bb++) {
+        qa[bb] += ss * _kk[aa] * _kk[bb] - _kk[aa] * _uu[bb] - _uu[aa] * _kk[bb];
+      }
+      qa += aa + 1;
+    }
+  }
+}
@@ -0,0 +1,93 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+#ifndef PPPKALMAN_H
+#define PPPKALMAN_H
+
+#include <string>
+#include <vector>
+#include <newmat/newmat.h>
+
+#include "bncconst.h"
+
+namespace BNC_PPP {
+
+// Measurement update of the PPP filter. The design matrix, observed-minus-
+// computed terms, weights, state increments and residuals live in buffers
+// that are sized once and reused epoch after epoch. Two backends:
+//   QR     - square-root covariance update (kalman() in bncutils)
+//   Joseph - sequential scalar updates in place on the packed lower
+//            triangle of the covariance matrix (symmetric Joseph form)
+// A single observation can be removed again from a completed update
+// (downdate) at O(nPar^2) cost, e.g. after it has been flagged as outlier.
+class t_pppKalman {
+ public:
+  enum t_backend {QR, Joseph};
+
+  t_pppKalman();
+  ~t_pppKalman();
+
+  static t_backend   backend(const std::string& name);
+  static const char* backendName(t_backend backend);
+
+  void      setBackend(t_backend backend) {_backend = backend;}
+  t_backend backend() const {return _backend;}
+
+  void     resize(unsigned nObs, unsigned nPar);
+  unsigned nObs() const {return _nObs;}
+  unsigned nPar() const {return _nPar;}
+  unsigned nObsUsed() const;
+
+  // 1-based accessors, same indexing as the NEWMAT matrices they replace
+  double& AA(unsigned iObs, unsigned iPar) {return _AA[(iObs-1)*_nPar + iPar-1];}
+  double& ll(unsigned iObs) {return _ll[iObs-1];}
+  double& PP(unsigned iObs) {return _PP[iObs-1];}
+  double  dx(unsigned iPar) const {return _dx[iPar-1];}
+  double  vv(unsigned iObs) const {return _vv[iObs-1];}
+
+  void  update(NEWMAT::SymmetricMatrix& QQ);
+  t_irc downdate(unsigned iObs, NEWMAT::SymmetricMatrix& QQ);
+
+ private:
+  void cmpResiduals();
+  void updateQR(NEWMAT::SymmetricMatrix& QQ);
+  void updateJoseph(NEWMAT::SymmetricMatrix& QQ);
+
+  t_backend             _backend;
+  unsigned              _nObs;
+  unsigned              _nPar;
+  std::vector<double>   _AA;
+  std::vector<double>   _ll;
+  std::vector<double>   _PP;
+  std::vector<double>   _dx;
+  std::vector<double>   _vv;
+  std::vector<double>   _uu;
+  std::vector<double>   _kk;
+  std::vector<unsigned> _nonZero;
+};
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      t_pppSmoother
+ *
+ * Purpose:    Backward smoothing pass for post-processing PPP
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include <string.h>
+#include <math.h>
+
+#include "pppSmoother.h"
+#include "pppFilter.h"
+
+using namespace BNC_PPP;
+using namespace std;
+using namespace NEWMAT;
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_pppSmoother::t_pppSmoother() {
+  _file.setFileTemplate(QDir::tempPath() + QDir::separator() + "bncSmoother_XXXXXX");
+  _isOpen       = _file.open();
+  _nPred        = 0;
+  _predNewArc   = false;
+  _fileSize     = 0;
+  _maxStateSize = 0;
+}
+
+// Destructor (the temporary file is removed)
+////////////////////////////////////////////////////////////////////////////
+t_pppSmoother::~t_pppSmoother() {
+}
+
+// Size of one state (identifiers, values, packed covariances) in bytes
+////////////////////////////////////////////////////////////////////////////
+qint64 t_pppSmoother::stateSize(int nPar) {
+  return nPar * (sizeof(t_parId) + sizeof(double)) + nPar*(nPar+1)/2 * sizeof(double);
+}
+
+// Append parameter identifiers, values and packed covariances
+////////////////////////////////////////////////////////////////////////////
+void t_pppSmoother::appendState(const QVector<t_pppParam*>& params,
+                                const SymmetricMatrix& QQ, bool pred,
+                                QByteArray& buffer) {
+  for (int ii = 0; ii < params.size(); ii++) {
+    const t_pppParam* par = params[ii];
+    t_parId id;
+    memset(&id, 0, sizeof(id));
+    id._type  = par->type;
+    id._reset = pred && (par->type == t_pppParam::RECCLK ||
+                         par->type == t_pppParam::GLONASS_OFFSET);
+    strncpy(id._prn, par->prn.toLatin1().data(), sizeof(id._prn) - 1);
+    buffer.append((const char*) &id, sizeof(id));
+  }
+  for (int ii = 0; ii < params.size(); ii++) {
+    double xx = params[ii]->xx;
+    buffer.append((const char*) &xx, sizeof(xx));
+  }
+  if (params.size() > 0) {
+    buffer.append((const char*) QQ.Store(), QQ.Storage() * sizeof(double));
+  }
+}
+
+// Predicted state of the current epoch (the last call before the update counts)
+////////////////////////////////////////////////////////////////////////////
+void t_pppSmoother::putPredicted(const QVector<t_pppParam*>& params,
+                                 const SymmetricMatrix& QQ, bool newArc) {
+  _predBuffer.clear();
+  appendState(params, QQ, true, _predBuffer);
+  _nPred      = params.size();
+  _predNewArc = newArc;
+}
+
+// Updated state of the current epoch, write the epoch record
+////////////////////////////////////////////////////////////////////////////
+void t_pppSmoother::putFiltered(const bncTime& tt, const QVector<t_pppParam*>& params,
+                                const SymmetricMatrix& QQ, double trp0) {
+  if (!_isOpen) {
+    return;
+  }
+
+  t_header header;
+  memset(&header, 0, sizeof(header));
+  header._mjd    = tt.mjd();
+  header._daysec = tt.daysec();
+  header._trp0   = trp0;
+  header._nPred  = _nPred;
+  header._nFilt  = params.size();
+  header._newArc = (_predNewArc || _offsets.empty());
+
+  QByteArray record((const char*) &header, sizeof(header));
+  record.append(_predBuffer);
+  appendState(params, QQ, false, record);
+
+  if (_file.write(record) != record.size()) {
+    _isOpen = false;
+    return;
+  }
+  _offsets.push_back(_fileSize);
+  _fileSize += record.size();
+
+  _maxStateSize = qMax(_maxStateSize, qMax(stateSize(_nPred), stateSize(params.size())));
+
+  _predBuffer.clear();
+  _nPred      = 0;
+  _predNewArc = false;
+}
+
+// Read a state from the mapped file, return pointer behind it
+////////////////////////////////////////////////////////////////////////////
+const char* t_pppSmoother::t_state::read(const char* data, int nPar) {
+  const t_parId* ids = (const t_parId*) data;
+  _ids.assign(ids, ids + nPar);
+  data += nPar * sizeof(t_parId);
+
+  _xx.ReSize(nPar);
+  _QQ.ReSize(nPar);
+  if (nPar > 0) {
+    memcpy(_xx.Store(), data, nPar * sizeof(double));
+    data += nPar * sizeof(double);
+    memcpy(_QQ.Store(), data, _QQ.Storage() * sizeof(double));
+    data += _QQ.Storage() * sizeof(double);
+  }
+  return data;
+}
+
+// Index of a parameter in a list of identifiers (-1 if not found)
+////////////////////////////////////////////////////////////////////////////
+int t_pppSmoother::find(const vector<t_parId>& ids, const t_parId& id) {
+  for (unsigned ii = 0; ii < ids.size(); ii++) {
+    if (ids[ii]._type == id._type && strncmp(ids[ii]._prn, id._prn, sizeof(id._prn)) == 0) {
+      return ii;
+    }
+  }
+  return -1;
+}
+
+// One backward step: xs = x + C (xs' - xp'), Qs = Q + C (Qs' - Qp') C^T
+// with gain C = Q F^T Qp'^-1. Only parameters carried over from this epoch
+// (neither reset nor newly set up) and still present in the smoothed state
+// of the next epoch enter, the others are uncorrelated in the prediction.
+////////////////////////////////////////////////////////////////////////////
+void t_pppSmoother::smoothStep(const t_state& pred, const t_state& smoothedNext,
+                               t_state& state) {
+
+  vector<int> iPred, iSmo, iState;
+  for (unsigned ii = 0; ii < pred._ids.size(); ii++) {
+    if (pred._ids[ii]._reset) {
+      continue;
+    }
+    int jj = find(smoothedNext._ids, pred._ids[ii]);
+    int kk = find(state._ids, pred._ids[ii]);
+    if (jj >= 0 && kk >= 0) {
+      iPred.push_back(ii);
+      iSmo.push_back(jj);
+      iState.push_back(kk);
+    }
+  }
+
+  int nS   = iPred.size();
+  int nPar = state._ids.size();
+  if (nS == 0) {
+    return;
+  }
+
+  ColumnVector    dx(nS);
+  SymmetricMatrix QP(nS);
+  SymmetricMatrix dQ(nS);
+  Matrix          AA(nPar, nS);
+  for (int aa = 0; aa < nS; aa++) {
+    dx(aa+1) = smoothedNext._xx(iSmo[aa]+1) - pred._xx(iPred[aa]+1);
+    for (int bb = 0; bb <= aa; bb++) {
+      QP(aa+1,bb+1) = pred._QQ(iPred[aa]+1, iPred[bb]+1);
+      dQ(aa+1,bb+1) = smoothedNext._QQ(iSmo[aa]+1, iSmo[bb]+1) - QP(aa+1,bb+1);
+    }
+    for (int ii = 0; ii < nPar; ii++) {
+      AA(ii+1,aa+1) = state._QQ(ii+1, iState[aa]+1);
+    }
+  }
+
+  Matrix CC = AA * QP.i();
+
+  state._xx += CC * dx;
+  SymmetricMatrix hlp; hlp << CC * dQ * CC.t();
+  state._QQ += hlp;
+}
+
+// Coordinates and troposphere of a state
+////////////////////////////////////////////////////////////////////////////
+t_pppSmoother::t_solution t_pppSmoother::solution(const t_header* header,
+                                                  const t_state& state) {
+  t_solution sol;
+  sol._time.setmjd(header->_daysec, int(header->_mjd));
+  sol._trp0   = header->_trp0;
+  sol._trp    = 0.0;
+  sol._sigTrp = 0.0;
+  sol._hasTrp = false;
+  for (int ii = 0; ii < 3; ii++) {
+    sol._xyz[ii]    = 0.0;
+    sol._sigXyz[ii] = 0.0;
+  }
+  for (unsigned ii = 0; ii < state._ids.size(); ii++) {
+    int    type = state._ids[ii]._type;
+    double sig  = sqrt(state._QQ(ii+1,ii+1));
+    if      (type == t_pppParam::CRD_X) {
+      sol._xyz[0] = state._xx(ii+1); sol._sigXyz[0] = sig;
+    }
+    else if (type == t_pppParam::CRD_Y) {
+      sol._xyz[1] = state._xx(ii+1); sol._sigXyz[1] = sig;
+    }
+    else if (type == t_pppParam::CRD_Z) {
+      sol._xyz[2] = state._xx(ii+1); sol._sigXyz[2] = sig;
+    }
+    else if (type == t_pppParam::TROPO) {
+      sol._trp    = state._xx(ii+1);
+      sol._sigTrp = sig;
+      sol._hasTrp = true;
+    }
+  }
+  return sol;
+}
+
+// Backward pass over all epochs, solutions in forward order
+////////////////////////////////////////////////////////////////////////////
+t_irc t_pppSmoother::smooth(vector<t_solution>& solutions) {
+
+  solutions.clear();
+  if (!_isOpen || _offsets.empty()) {
+    return failure;
+  }
+
+  _file.flush();
+  const char* data = (const char*) _file.map(0, _fileSize);
+  if (!data) {
+    return failure;
+  }
+
+  int nEpo = _offsets.size();
+  solutions.resize(nEpo);
+
+  t_state pred;          // predicted state of the next epoch
+  t_state smoothedNext;  // smoothed state of the next epoch
+  for (int iEpo = nEpo-1; iEpo >= 0; iEpo--) {
+    const t_header* header = (const t_header*) (data + _offsets[iEpo]);
+    const char* filtData = data + _offsets[iEpo] + sizeof(t_header) + stateSize(header->_nPred);
+
+    t_state state;
+    state.read(filtData, header->_nFilt);
+
+    if (iEpo < nEpo-1) {
+      const t_header* next = (const t_header*) (data + _offsets[iEpo+1]);
+      if (!next->_newArc) {
+        pred.read((const char*) next + sizeof(t_header), next->_nPred);
+        try {
+          smoothStep(pred, smoothedNext, state);
+        }
+        catch (...) {
+          // singular prediction: keep the filtered state
+        }
+      }
+    }
+
+    solutions[iEpo] = solution(header, state);
+    smoothedNext = state;
+  }
+
+  _file.unmap((uchar*) data);
+  return success;
+}
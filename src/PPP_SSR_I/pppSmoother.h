@@ -0,0 +1,123 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+
+#ifndef PPPSMOOTHER_H
+#define PPPSMOOTHER_H
+
+#include <string>
+#include <vector>
+#include <newmat/newmat.h>
+#include <QtCore>
+
+#include "bncconst.h"
+#include "bnctime.h"
+
+namespace BNC_PPP {
+
+class t_pppParam;
+
+// Fixed-interval (Rauch-Tung-Striebel) smoother for post-processing PPP.
+// For each successful epoch the forward filter hands over the predicted
+// and the updated state. Both are appended, covariances packed, to a
+// temporary file. The backward pass maps this file into memory and keeps
+// only the smoothed state of the following epoch in RAM.
+class t_pppSmoother {
+ public:
+  class t_solution {
+   public:
+    bncTime _time;
+    double  _xyz[3];
+    double  _sigXyz[3];
+    double  _trp0;
+    double  _trp;
+    double  _sigTrp;
+    bool    _hasTrp;
+  };
+
+  t_pppSmoother();
+  ~t_pppSmoother();
+
+  bool  isOpen() const {return _isOpen;}
+  void  putPredicted(const QVector<t_pppParam*>& params,
+                     const NEWMAT::SymmetricMatrix& QQ, bool newArc);
+  void  putFiltered(const bncTime& tt, const QVector<t_pppParam*>& params,
+                    const NEWMAT::SymmetricMatrix& QQ, double trp0);
+  t_irc smooth(std::vector<t_solution>& solutions);
+
+  int    numEpochs() const {return _offsets.size();}
+  qint64 fileSize() const {return _fileSize;}
+  qint64 maxStateSize() const {return _maxStateSize;}
+
+ private:
+  // Identification of a parameter across epochs
+  struct t_parId {
+    int  _type;
+    int  _reset;   // predicted value independent of the previous epoch
+    char _prn[8];
+  };
+
+  // Layout of one epoch in the temporary file: header, predicted
+  // parameters, values and packed covariances, the same for the update
+  struct t_header {
+    double _mjd;
+    double _daysec;
+    double _trp0;
+    int    _nPred;
+    int    _nFilt;
+    int    _newArc;
+    int    _unused;
+  };
+
+  class t_state {
+   public:
+    const char* read(const char* data, int nPar);
+    std::vector<t_parId>    _ids;
+    NEWMAT::ColumnVector    _xx;
+    NEWMAT::SymmetricMatrix _QQ;
+  };
+
+  static void   appendState(const QVector<t_pppParam*>& params,
+                            const NEWMAT::SymmetricMatrix& QQ, bool pred,
+                            QByteArray& buffer);
+  static qint64 stateSize(int nPar);
+  static int    find(const std::vector<t_parId>& ids, const t_parId& id);
+  static void   smoothStep(const t_state& pred, const t_state& smoothedNext,
+                           t_state& state);
+  static t_solution solution(const t_header* header, const t_state& state);
+
+  QTemporaryFile      _file;
+  bool                _isOpen;
+  QByteArray          _predBuffer;
+  int                 _nPred;
+  bool                _predNewArc;
+  std::vector<qint64> _offsets;
+  qint64              _fileSize;
+  qint64              _maxStateSize;
+};
+
+}
+
+#endif
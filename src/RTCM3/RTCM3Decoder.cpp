@@ -45,6 +45,7 @@
 #include <string.h>
 
 #include "bits.h"
+#include "crc24q.h"
 #include "gnss.h"
 #include "RTCM3Decoder.h"
 #include "rtcm_utils.h"
@@ -74,7 +75,7 @@ RTCM3Decoder::RTCM3Decoder(const QString& staID, bncRawFile* rawFile) :
   connect(this, SIGNAL(newSBASEph(t_ephSBAS)),   BNC_CORE, SLOT(slotNewSBASEph(t_ephSBAS)));
   connect(this, SIGNAL(newBDSEph(t_ephBDS)),     BNC_CORE, SLOT(slotNewBDSEph(t_ephBDS)));
 
-  _MessageSize = _SkipBytes = _BlockSize = _NeedBytes = 0;
+  _MessageSize = 0;
 }
 
 // Destructor
@@ -130,7 +131,7 @@ bool RTCM3Decoder::DecodeRTCM3GPS(unsigned char* data, int size)
     else
       CurrentObs._prn.set('S', sv-20);
 
-    t_frqObs *frqObs = new t_frqObs;
+    t_frqObs *frqObs = CurrentObs._obs.append("");
     /* L1 */
     GETBITS(code, 1);
     (code) ? frqObs->_rnxType2ch.assign("1W") : frqObs->_rnxType2ch.assign("1C");
@@ -159,10 +160,9 @@ bool RTCM3Decoder::DecodeRTCM3GPS(unsigned char* data, int size)
         frqObs->_snrValid = true;
       }
     }
-    CurrentObs._obs.push_back(frqObs);
     if(type == 1003 || type == 1004)
     {
-      frqObs = new t_frqObs;
+      frqObs = CurrentObs._obs.append("");
       /* L2 */
       GETBITS(code,2);
       switch(code)
@@ -195,7 +195,6 @@ bool RTCM3Decoder::DecodeRTCM3GPS(unsigned char* data, int size)
           frqObs->_snrValid = true;
         }
       }
-      CurrentObs._obs.push_back(frqObs);
     }
     _CurrentObsList.push_back(CurrentObs);
   }
@@ -698,10 +697,9 @@ bool RTCM3Decoder::DecodeRTCM3MSM(unsigned char* data, int size)
             cd = gal[RTCM3_MSM_NUMSIG-j-1];
             break;
           }
-          if(cd.code)
+          if(cd.code && !CurrentObs._obs.full())
           {
-            t_frqObs *frqObs = new t_frqObs;
-            frqObs->_rnxType2ch.assign(cd.code);
+            t_frqObs *frqObs = CurrentObs._obs.append(cd.code);
 
             switch(type % 10)
             {
@@ -827,7 +825,6 @@ bool RTCM3Decoder::DecodeRTCM3MSM(unsigned char* data, int size)
               }
               break;
             }
-            CurrentObs._obs.push_back(frqObs);
           }
         }
       }
@@ -891,7 +888,7 @@ bool RTCM3Decoder::DecodeRTCM3GLONASS(unsigned char* data, int size)
     GETBITS(freq, 5)
     GLOFreq[sv-1] = 100+freq-7; /* store frequency for other users (MSM) */
 
-    t_frqObs *frqObs = new t_frqObs;
+    t_frqObs *frqObs = CurrentObs._obs.append("");
     /* L1 */
     (code) ? frqObs->_rnxType2ch.assign("1P") : frqObs->_rnxType2ch.assign("1C");
     GETBITS(l1range, 25);
@@ -919,10 +916,9 @@ bool RTCM3Decoder::DecodeRTCM3GLONASS(unsigned char* data, int size)
         frqObs->_snrValid = true;
       }
     }
-    CurrentObs._obs.push_back(frqObs);
     if(type == 1011 || type == 1012)
     {
-      frqObs = new t_frqObs;
+      frqObs = CurrentObs._obs.append("");
       /* L2 */
       GETBITS(code,2);
       switch(code)
@@ -955,7 +951,6 @@ bool RTCM3Decoder::DecodeRTCM3GLONASS(unsigned char* data, int size)
           frqObs->_snrValid = true;
         }
       }
-      CurrentObs._obs.push_back(frqObs);
     }
     _CurrentObsList.push_back(CurrentObs);
   }
@@ -1446,105 +1441,145 @@ bool RTCM3Decoder::DecodeAntennaPosition(unsigned char* data, int size)
   return true;
 }
 
+//
+////////////////////////////////////////////////////////////////////////////
+bool RTCM3Decoder::DecodeMessage(unsigned char* msg, int msgLen, vector<string>& errmsg)
+{
+  bool decoded = false;
+  int id = (msg[3]<<4)|(msg[4]>>4);
+
+  /* reset station ID for file loading as it can change */
+  if(_rawFile)
+    _staID = _rawFile->staID();
+  /* store the id into the list of loaded blocks */
+  _typeList.push_back(id);
+
+  /* SSR I+II data handled in another function, already pass the
+   * extracted data block. That does no harm, as it anyway skip everything
+   * else. */
+  if((id >= 1057 && id <= 1068) || (id >= 1240 && id <= 1270))
+  {
+    if (!_coDecoders.contains(_staID.toLatin1()))
+      _coDecoders[_staID.toLatin1()] = new RTCM3coDecoder(_staID);
+    RTCM3coDecoder* coDecoder = _coDecoders[_staID.toLatin1()];
+    if(coDecoder->Decode(reinterpret_cast<char *>(msg), msgLen,
+    errmsg) == success)
+    {
+      decoded = true;
+    }
+  }
+  else if(id >= 1070 && id <= 1229) /* MSM */
+  {
+    if(DecodeRTCM3MSM(msg, msgLen))
+      decoded = true;
+  }
+  else
+  {
+    switch(id)
+    {
+    case 1001: case 1003:
+      emit(newMessage(QString("%1: Block %2 contain partial data! Ignored!")
+      .arg(_staID).arg(id).toLatin1(), true));
+      break; /* no use decoding partial data ATM, remove break when data can be used */
+    case 1002: case 1004:
+      if(DecodeRTCM3GPS(msg, msgLen))
+        decoded = true;
+      break;
+    case 1009: case 1011:
+      emit(newMessage(QString("%1: Block %2 contain partial data! Ignored!")
+      .arg(_staID).arg(id).toLatin1(), true));
+      break; /* no use decoding partial data ATM, remove break when data can be used */
+    case 1010: case 1012:
+      if(DecodeRTCM3GLONASS(msg, msgLen))
+        decoded = true;
+      break;
+    case 1019:
+      if(DecodeGPSEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case 1020:
+      if(DecodeGLONASSEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case 1043:
+      if(DecodeSBASEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case 1044:
+      if(DecodeQZSSEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case 1045: case 1046:
+      if(DecodeGalileoEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case RTCM3ID_BDS:
+      if(DecodeBDSEphemeris(msg, msgLen))
+        decoded = true;
+      break;
+    case 1007: case 1008: case 1033:
+      DecodeAntenna(msg, msgLen);
+      break;
+    case 1005: case 1006:
+      DecodeAntennaPosition(msg, msgLen);
+      break;
+    }
+  }
+  return decoded;
+}
+
 //
 ////////////////////////////////////////////////////////////////////////////
 t_irc RTCM3Decoder::Decode(char* buffer, int bufLen, vector<string>& errmsg)
 {
   bool decoded = false;
+  unsigned char *pos = reinterpret_cast<unsigned char *>(buffer);
+  unsigned char *end = pos + bufLen;
+  size_t len;
 
   errmsg.clear();
 
-  while(bufLen && _MessageSize < sizeof(_Message))
+  /* complete a frame carried over from the previous call, only the
+   * missing bytes are copied */
+  while(_MessageSize && pos < end)
   {
-    int l = sizeof(_Message) - _MessageSize;
-    if(l > bufLen)
-      l = bufLen;
-    memcpy(_Message+_MessageSize, buffer, l);
-    _MessageSize += l;
-    bufLen -= l;
-    buffer += l;
-    int id;
-    while((id = GetMessage()))
+    size_t need = _MessageSize < 3 ? 3 : (((_Message[1]&3)<<8)|_Message[2]) + 6;
+    size_t take = need - _MessageSize;
+    if(take > static_cast<size_t>(end-pos))
+      take = end-pos;
+    memcpy(_Message+_MessageSize, pos, take);
+    _MessageSize += take;
+    pos += take;
+    if(_MessageSize < need || need == 3)
+      continue;
+
+    /* a CRC failure leaves the remaining carried bytes to be rescanned */
+    unsigned char *m = _Message;
+    unsigned char *e = _Message+_MessageSize;
+    while((len = GetMessage(m, e)))
     {
-      /* reset station ID for file loading as it can change */
-      if(_rawFile)
-        _staID = _rawFile->staID();
-      /* store the id into the list of loaded blocks */
-      _typeList.push_back(id);
-
-      /* SSR I+II data handled in another function, already pass the
-       * extracted data block. That does no harm, as it anyway skip everything
-       * else. */
-      if((id >= 1057 && id <= 1068) || (id >= 1240 && id <= 1270))
-      {
-        if (!_coDecoders.contains(_staID.toLatin1()))
-          _coDecoders[_staID.toLatin1()] = new RTCM3coDecoder(_staID);
-        RTCM3coDecoder* coDecoder = _coDecoders[_staID.toLatin1()];
-        if(coDecoder->Decode(reinterpret_cast<char *>(_Message), _BlockSize,
-        errmsg) == success)
-        {
-          decoded = true;
-        }
-      }
-      else if(id >= 1070 && id <= 1229) /* MSM */
-      {
-        if(DecodeRTCM3MSM(_Message, _BlockSize))
-          decoded = true;
-      }
-      else
-      {
-        switch(id)
-        {
-        case 1001: case 1003:
-          emit(newMessage(QString("%1: Block %2 contain partial data! Ignored!")
-          .arg(_staID).arg(id).toLatin1(), true));
-          break; /* no use decoding partial data ATM, remove break when data can be used */
-        case 1002: case 1004:
-          if(DecodeRTCM3GPS(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1009: case 1011:
-          emit(newMessage(QString("%1: Block %2 contain partial data! Ignored!")
-          .arg(_staID).arg(id).toLatin1(), true));
-          break; /* no use decoding partial data ATM, remove break when data can be used */
-        case 1010: case 1012:
-          if(DecodeRTCM3GLONASS(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1019:
-          if(DecodeGPSEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1020:
-          if(DecodeGLONASSEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1043:
-          if(DecodeSBASEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1044:
-          if(DecodeQZSSEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1045: case 1046:
-          if(DecodeGalileoEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case RTCM3ID_BDS:
-          if(DecodeBDSEphemeris(_Message, _BlockSize))
-            decoded = true;
-          break;
-        case 1007: case 1008: case 1033:
-          DecodeAntenna(_Message, _BlockSize);
-          break;
-        case 1005: case 1006:
-          DecodeAntennaPosition(_Message, _BlockSize);
-          break;
-        }
-      }
+      if(DecodeMessage(m, len, errmsg))
+        decoded = true;
+      m += len;
     }
+    _MessageSize = e-m;
+    if(_MessageSize && m != _Message)
+      memmove(_Message, m, _MessageSize);
+  }
+
+  /* frames lying completely inside the caller's buffer are decoded in place */
+  while((len = GetMessage(pos, end)))
+  {
+    if(DecodeMessage(pos, len, errmsg))
+      decoded = true;
+    pos += len;
+  }
+  if(pos < end)
+  {
+    _MessageSize = end-pos;
+    memcpy(_Message, pos, _MessageSize);
   }
+
   return decoded ? success : failure;
 };
 
@@ -1552,68 +1587,41 @@ t_irc RTCM3Decoder::Decode(char* buffer, int bufLen, vector<string>& errmsg)
 ////////////////////////////////////////////////////////////////////////////
 uint32_t RTCM3Decoder::CRC24(long size, const unsigned char *buf)
 {
-  uint32_t crc = 0;
-  int i;
-
-  while(size--)
-  {
-    crc ^= (*buf++) << (16);
-    for(i = 0; i < 8; i++)
-    {
-      crc <<= 1;
-      if(crc & 0x1000000)
-        crc ^= 0x01864cfb;
-    }
-  }
-  return crc;
+  return crc24q(size, buf);
 }
 
 //
 ////////////////////////////////////////////////////////////////////////////
-int RTCM3Decoder::GetMessage(void)
+size_t RTCM3Decoder::GetMessage(unsigned char*& pos, unsigned char* end)
 {
-  unsigned char *m, *e;
-  int i;
+  unsigned char *m = pos;
 
-  m = _Message+_SkipBytes;
-  e = _Message+_MessageSize;
-  _NeedBytes = _SkipBytes = 0;
-  while(e-m >= 3)
+  while(m < end)
   {
-    if(m[0] == 0xD3)
+    if(m[0] != 0xD3)
     {
-      _BlockSize = ((m[1]&3)<<8)|m[2];
-      if(e-m >= static_cast<int>(_BlockSize+6))
-      {
-        if(static_cast<uint32_t>((m[3+_BlockSize]<<16)|(m[3+_BlockSize+1]<<8)
-        |(m[3+_BlockSize+2])) == CRC24(_BlockSize+3, m))
-        {
-          _BlockSize +=6;
-          _SkipBytes = _BlockSize;
-          break;
-        }
-        else
-          ++m;
-      }
-      else
+      m = static_cast<unsigned char *>(memchr(m, 0xD3, end-m));
+      if(!m)
       {
-        _NeedBytes = _BlockSize;
-        break;
+        pos = end;
+        return 0;
       }
     }
-    else
-      ++m;
+    if(end-m < 3)
+      break;
+    size_t len = (((m[1]&3)<<8)|m[2]) + 6;
+    if(static_cast<size_t>(end-m) < len)
+      break;
+    if(static_cast<uint32_t>((m[len-3]<<16)|(m[len-2]<<8)|m[len-1])
+    == CRC24(len-3, m))
+    {
+      pos = m;
+      return len;
+    }
+    ++m;
   }
-  if(e-m < 3)
-    _NeedBytes = 3;
-
-  /* copy buffer to front */
-  i = m - _Message;
-  if(i && m < e)
-    memmove(_Message, m, static_cast<size_t>(_MessageSize-i));
-  _MessageSize -= i;
-
-  return !_NeedBytes ? ((_Message[3]<<4)|(_Message[4]>>4)) : 0;
+  pos = m;
+  return 0;
 }
 
 // Time of Corrections
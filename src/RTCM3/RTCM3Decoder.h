@@ -59,19 +59,23 @@ Q_OBJECT
 
  private:
   /**
-   * Extract a RTCM3 message. Data is passed in the follow fields:<br>
-   * {@link _Message}: contains the message bytes<br>
-   * {@link _MessageSize}: contains to current amount of bytes in the buffer<br>
-   * {@link _SkipBytes}: amount of bytes to skip at the beginning of the buffer
-   * 
-   * The functions sets following variables:<br>
-   * {@link _NeedBytes}: Minimum number of bytes needed on next call<br>
-   * {@link _SkipBytes}: internal, Bytes to skip before next call (usually the amount of
-   *   found bytes)<br>
-   * {@link _MessageSize}: Updated size after processed bytes have been removed from buffer
-   * @return message number when message found, 0 otherwise
-   */
-  int GetMessage(void);
+   * Find the next RTCM3 frame with valid CRC in a byte range. No data is
+   * copied, the frame is returned as a view into the scanned buffer.
+   * @param pos start of the range, set to the frame start on success, otherwise
+   *   to the first byte of a possibly incomplete frame (or <code>end</code>)
+   * @param end end of the range
+   * @return length of the frame including header+crc, 0 when no complete frame
+   *   was found
+   */
+  size_t GetMessage(unsigned char*& pos, unsigned char* end);
+  /**
+   * Dispatch one complete RTCM3 frame to the matching decoder function.
+   * @param msg the frame including header
+   * @param msgLen the frame length including header+crc
+   * @param errmsg error messages of the SSR decoder
+   * @return <code>true</code> when data was decoded
+   */
+  bool DecodeMessage(unsigned char* msg, int msgLen, std::vector<std::string>& errmsg);
   /**
    * Extract data from old 1001-1004 RTCM3 messages.
    * @param buffer the buffer containing an 1001-1004 RTCM block
@@ -167,18 +171,10 @@ Q_OBJECT
   /** List of decoders for Clock and Orbit data */
   QMap<QByteArray, RTCM3coDecoder*> _coDecoders; 
 
-  /** Message buffer for input parsing */
+  /** Carry buffer for a frame split across two {@link Decode()} calls */
   unsigned char _Message[2048];
-  /** Current size of the message buffer */
+  /** Current size of the carry buffer */
   size_t _MessageSize;
-  /** Minimum bytes required to have success during next {@link GetMessage()} call */
-  size_t _NeedBytes;
-  /** Bytes to skip in next {@link GetMessage()} call, intrnal to that function */
-  size_t _SkipBytes;
-  /** Size of the current RTCM3 block beginning at buffer start after a successful
-   *  {@link GetMessage()} call
-   */
-  size_t _BlockSize;
 
   /**
    * Current observation epoch. Used to link together blocks in one epoch.
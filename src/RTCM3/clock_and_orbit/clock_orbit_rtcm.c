@@ -16,24 +16,9 @@
 #include <sys/types.h>
 #endif
 #include "clock_orbit_rtcm.h"
+#include "crc24q.h"
 
-static uint32_t CRC24(long size, const unsigned char *buf)
-{
-  uint32_t crc = 0;
-  int i;
-
-  while(size--)
-  {
-    crc ^= (*buf++) << (16);
-    for(i = 0; i < 8; i++)
-    {
-      crc <<= 1;
-      if(crc & 0x1000000)
-        crc ^= 0x01864cfb;
-    }
-  }
-  return crc;
-}
+#define CRC24(size, buf) crc24q(size, buf)
 
 /* NOTE: These defines are interlinked with below functions and directly modify
 the values. This may not be optimized in terms of final program code size but
@@ -0,0 +1,397 @@
+/* Programheader
+
+        Name:           crc24q.c
+        Project:        RTCM3
+        Description:    table driven CRC24Q checksum (slicing-by-8)
+*/
+
+#include "crc24q.h"
+
+/* The 24 bit register is kept left aligned in a 32 bit word (polynomial
+   0x1864CFB shifted by 8), so the usual MSB-first slicing-by-8 scheme
+   applies. Table k holds the contribution of a byte followed by k zero
+   bytes: tab[0][n] = n*x^24 mod P, tab[k][n] = (tab[k-1][n]<<8) ^
+   tab[0][tab[k-1][n]>>24]. */
+static const uint32_t crc24qtab[8][256] = {
+  {
+    0x00000000U, 0x864cfb00U, 0x8ad50d00U, 0x0c99f600U, 0x93e6e100U, 0x15aa1a00U,
+    0x1933ec00U, 0x9f7f1700U, 0xa1813900U, 0x27cdc200U, 0x2b543400U, 0xad18cf00U,
+    0x3267d800U, 0xb42b2300U, 0xb8b2d500U, 0x3efe2e00U, 0xc54e8900U, 0x43027200U,
+    0x4f9b8400U, 0xc9d77f00U, 0x56a86800U, 0xd0e49300U, 0xdc7d6500U, 0x5a319e00U,
+    0x64cfb000U, 0xe2834b00U, 0xee1abd00U, 0x68564600U, 0xf7295100U, 0x7165aa00U,
+    0x7dfc5c00U, 0xfbb0a700U, 0x0cd1e900U, 0x8a9d1200U, 0x8604e400U, 0x00481f00U,
+    0x9f370800U, 0x197bf300U, 0x15e20500U, 0x93aefe00U, 0xad50d000U, 0x2b1c2b00U,
+    0x2785dd00U, 0xa1c92600U, 0x3eb63100U, 0xb8faca00U, 0xb4633c00U, 0x322fc700U,
+    0xc99f6000U, 0x4fd39b00U, 0x434a6d00U, 0xc5069600U, 0x5a798100U, 0xdc357a00U,
+    0xd0ac8c00U, 0x56e07700U, 0x681e5900U, 0xee52a200U, 0xe2cb5400U, 0x6487af00U,
+    0xfbf8b800U, 0x7db44300U, 0x712db500U, 0xf7614e00U, 0x19a3d200U, 0x9fef2900U,
+    0x9376df00U, 0x153a2400U, 0x8a453300U, 0x0c09c800U, 0x00903e00U, 0x86dcc500U,
+    0xb822eb00U, 0x3e6e1000U, 0x32f7e600U, 0xb4bb1d00U, 0x2bc40a00U, 0xad88f100U,
+    0xa1110700U, 0x275dfc00U, 0xdced5b00U, 0x5aa1a000U, 0x56385600U, 0xd074ad00U,
+    0x4f0bba00U, 0xc9474100U, 0xc5deb700U, 0x43924c00U, 0x7d6c6200U, 0xfb209900U,
+    0xf7b96f00U, 0x71f59400U, 0xee8a8300U, 0x68c67800U, 0x645f8e00U, 0xe2137500U,
+    0x15723b00U, 0x933ec000U, 0x9fa73600U, 0x19ebcd00U, 0x8694da00U, 0x00d82100U,
+    0x0c41d700U, 0x8a0d2c00U, 0xb4f30200U, 0x32bff900U, 0x3e260f00U, 0xb86af400U,
+    0x2715e300U, 0xa1591800U, 0xadc0ee00U, 0x2b8c1500U, 0xd03cb200U, 0x56704900U,
+    0x5ae9bf00U, 0xdca54400U, 0x43da5300U, 0xc596a800U, 0xc90f5e00U, 0x4f43a500U,
+    0x71bd8b00U, 0xf7f17000U, 0xfb688600U, 0x7d247d00U, 0xe25b6a00U, 0x64179100U,
+    0x688e6700U, 0xeec29c00U, 0x3347a400U, 0xb50b5f00U, 0xb992a900U, 0x3fde5200U,
+    0xa0a14500U, 0x26edbe00U, 0x2a744800U, 0xac38b300U, 0x92c69d00U, 0x148a6600U,
+    0x18139000U, 0x9e5f6b00U, 0x01207c00U, 0x876c8700U, 0x8bf57100U, 0x0db98a00U,
+    0xf6092d00U, 0x7045d600U, 0x7cdc2000U, 0xfa90db00U, 0x65efcc00U, 0xe3a33700U,
+    0xef3ac100U, 0x69763a00U, 0x57881400U, 0xd1c4ef00U, 0xdd5d1900U, 0x5b11e200U,
+    0xc46ef500U, 0x42220e00U, 0x4ebbf800U, 0xc8f70300U, 0x3f964d00U, 0xb9dab600U,
+    0xb5434000U, 0x330fbb00U, 0xac70ac00U, 0x2a3c5700U, 0x26a5a100U, 0xa0e95a00U,
+    0x9e177400U, 0x185b8f00U, 0x14c27900U, 0x928e8200U, 0x0df19500U, 0x8bbd6e00U,
+    0x87249800U, 0x01686300U, 0xfad8c400U, 0x7c943f00U, 0x700dc900U, 0xf6413200U,
+    0x693e2500U, 0xef72de00U, 0xe3eb2800U, 0x65a7d300U, 0x5b59fd00U, 0xdd150600U,
+    0xd18cf000U, 0x57c00b00U, 0xc8bf1c00U, 0x4ef3e700U, 0x426a1100U, 0xc426ea00U,
+    0x2ae47600U, 0xaca88d00U, 0xa0317b00U, 0x267d8000U, 0xb9029700U, 0x3f4e6c00U,
+    0x33d79a00U, 0xb59b6100U, 0x8b654f00U, 0x0d29b400U, 0x01b04200U, 0x87fcb900U,
+    0x1883ae00U, 0x9ecf5500U, 0x9256a300U, 0x141a5800U, 0xefaaff00U, 0x69e60400U,
+    0x657ff200U, 0xe3330900U, 0x7c4c1e00U, 0xfa00e500U, 0xf6991300U, 0x70d5e800U,
+    0x4e2bc600U, 0xc8673d00U, 0xc4fecb00U, 0x42b23000U, 0xddcd2700U, 0x5b81dc00U,
+    0x57182a00U, 0xd154d100U, 0x26359f00U, 0xa0796400U, 0xace09200U, 0x2aac6900U,
+    0xb5d37e00U, 0x339f8500U, 0x3f067300U, 0xb94a8800U, 0x87b4a600U, 0x01f85d00U,
+    0x0d61ab00U, 0x8b2d5000U, 0x14524700U, 0x921ebc00U, 0x9e874a00U, 0x18cbb100U,
+    0xe37b1600U, 0x6537ed00U, 0x69ae1b00U, 0xefe2e000U, 0x709df700U, 0xf6d10c00U,
+    0xfa48fa00U, 0x7c040100U, 0x42fa2f00U, 0xc4b6d400U, 0xc82f2200U, 0x4e63d900U,
+    0xd11cce00U, 0x57503500U, 0x5bc9c300U, 0xdd853800U
+  },
+  {
+    0x00000000U, 0x668f4800U, 0xcd1e9000U, 0xab91d800U, 0x1c71db00U, 0x7afe9300U,
+    0xd16f4b00U, 0xb7e00300U, 0x38e3b600U, 0x5e6cfe00U, 0xf5fd2600U, 0x93726e00U,
+    0x24926d00U, 0x421d2500U, 0xe98cfd00U, 0x8f03b500U, 0x71c76c00U, 0x17482400U,
+    0xbcd9fc00U, 0xda56b400U, 0x6db6b700U, 0x0b39ff00U, 0xa0a82700U, 0xc6276f00U,
+    0x4924da00U, 0x2fab9200U, 0x843a4a00U, 0xe2b50200U, 0x55550100U, 0x33da4900U,
+    0x984b9100U, 0xfec4d900U, 0xe38ed800U, 0x85019000U, 0x2e904800U, 0x481f0000U,
+    0xffff0300U, 0x99704b00U, 0x32e19300U, 0x546edb00U, 0xdb6d6e00U, 0xbde22600U,
+    0x1673fe00U, 0x70fcb600U, 0xc71cb500U, 0xa193fd00U, 0x0a022500U, 0x6c8d6d00U,
+    0x9249b400U, 0xf4c6fc00U, 0x5f572400U, 0x39d86c00U, 0x8e386f00U, 0xe8b72700U,
+    0x4326ff00U, 0x25a9b700U, 0xaaaa0200U, 0xcc254a00U, 0x67b49200U, 0x013bda00U,
+    0xb6dbd900U, 0xd0549100U, 0x7bc54900U, 0x1d4a0100U, 0x41514b00U, 0x27de0300U,
+    0x8c4fdb00U, 0xeac09300U, 0x5d209000U, 0x3bafd800U, 0x903e0000U, 0xf6b14800U,
+    0x79b2fd00U, 0x1f3db500U, 0xb4ac6d00U, 0xd2232500U, 0x65c32600U, 0x034c6e00U,
+    0xa8ddb600U, 0xce52fe00U, 0x30962700U, 0x56196f00U, 0xfd88b700U, 0x9b07ff00U,
+    0x2ce7fc00U, 0x4a68b400U, 0xe1f96c00U, 0x87762400U, 0x08759100U, 0x6efad900U,
+    0xc56b0100U, 0xa3e44900U, 0x14044a00U, 0x728b0200U, 0xd91ada00U, 0xbf959200U,
+    0xa2df9300U, 0xc450db00U, 0x6fc10300U, 0x094e4b00U, 0xbeae4800U, 0xd8210000U,
+    0x73b0d800U, 0x153f9000U, 0x9a3c2500U, 0xfcb36d00U, 0x5722b500U, 0x31adfd00U,
+    0x864dfe00U, 0xe0c2b600U, 0x4b536e00U, 0x2ddc2600U, 0xd318ff00U, 0xb597b700U,
+    0x1e066f00U, 0x78892700U, 0xcf692400U, 0xa9e66c00U, 0x0277b400U, 0x64f8fc00U,
+    0xebfb4900U, 0x8d740100U, 0x26e5d900U, 0x406a9100U, 0xf78a9200U, 0x9105da00U,
+    0x3a940200U, 0x5c1b4a00U, 0x82a29600U, 0xe42dde00U, 0x4fbc0600U, 0x29334e00U,
+    0x9ed34d00U, 0xf85c0500U, 0x53cddd00U, 0x35429500U, 0xba412000U, 0xdcce6800U,
+    0x775fb000U, 0x11d0f800U, 0xa630fb00U, 0xc0bfb300U, 0x6b2e6b00U, 0x0da12300U,
+    0xf365fa00U, 0x95eab200U, 0x3e7b6a00U, 0x58f42200U, 0xef142100U, 0x899b6900U,
+    0x220ab100U, 0x4485f900U, 0xcb864c00U, 0xad090400U, 0x0698dc00U, 0x60179400U,
+    0xd7f79700U, 0xb178df00U, 0x1ae90700U, 0x7c664f00U, 0x612c4e00U, 0x07a30600U,
+    0xac32de00U, 0xcabd9600U, 0x7d5d9500U, 0x1bd2dd00U, 0xb0430500U, 0xd6cc4d00U,
+    0x59cff800U, 0x3f40b000U, 0x94d16800U, 0xf25e2000U, 0x45be2300U, 0x23316b00U,
+    0x88a0b300U, 0xee2ffb00U, 0x10eb2200U, 0x76646a00U, 0xddf5b200U, 0xbb7afa00U,
+    0x0c9af900U, 0x6a15b100U, 0xc1846900U, 0xa70b2100U, 0x28089400U, 0x4e87dc00U,
+    0xe5160400U, 0x83994c00U, 0x34794f00U, 0x52f60700U, 0xf967df00U, 0x9fe89700U,
+    0xc3f3dd00U, 0xa57c9500U, 0x0eed4d00U, 0x68620500U, 0xdf820600U, 0xb90d4e00U,
+    0x129c9600U, 0x7413de00U, 0xfb106b00U, 0x9d9f2300U, 0x360efb00U, 0x5081b300U,
+    0xe761b000U, 0x81eef800U, 0x2a7f2000U, 0x4cf06800U, 0xb234b100U, 0xd4bbf900U,
+    0x7f2a2100U, 0x19a56900U, 0xae456a00U, 0xc8ca2200U, 0x635bfa00U, 0x05d4b200U,
+    0x8ad70700U, 0xec584f00U, 0x47c99700U, 0x2146df00U, 0x96a6dc00U, 0xf0299400U,
+    0x5bb84c00U, 0x3d370400U, 0x207d0500U, 0x46f24d00U, 0xed639500U, 0x8becdd00U,
+    0x3c0cde00U, 0x5a839600U, 0xf1124e00U, 0x979d0600U, 0x189eb300U, 0x7e11fb00U,
+    0xd5802300U, 0xb30f6b00U, 0x04ef6800U, 0x62602000U, 0xc9f1f800U, 0xaf7eb000U,
+    0x51ba6900U, 0x37352100U, 0x9ca4f900U, 0xfa2bb100U, 0x4dcbb200U, 0x2b44fa00U,
+    0x80d52200U, 0xe65a6a00U, 0x6959df00U, 0x0fd69700U, 0xa4474f00U, 0xc2c80700U,
+    0x75280400U, 0x13a74c00U, 0xb8369400U, 0xdeb9dc00U
+  },
+  {
+    0x00000000U, 0x8309d700U, 0x805f5500U, 0x03568200U, 0x86f25100U, 0x05fb8600U,
+    0x06ad0400U, 0x85a4d300U, 0x8ba85900U, 0x08a18e00U, 0x0bf70c00U, 0x88fedb00U,
+    0x0d5a0800U, 0x8e53df00U, 0x8d055d00U, 0x0e0c8a00U, 0x911c4900U, 0x12159e00U,
+    0x11431c00U, 0x924acb00U, 0x17ee1800U, 0x94e7cf00U, 0x97b14d00U, 0x14b89a00U,
+    0x1ab41000U, 0x99bdc700U, 0x9aeb4500U, 0x19e29200U, 0x9c464100U, 0x1f4f9600U,
+    0x1c191400U, 0x9f10c300U, 0xa4746900U, 0x277dbe00U, 0x242b3c00U, 0xa722eb00U,
+    0x22863800U, 0xa18fef00U, 0xa2d96d00U, 0x21d0ba00U, 0x2fdc3000U, 0xacd5e700U,
+    0xaf836500U, 0x2c8ab200U, 0xa92e6100U, 0x2a27b600U, 0x29713400U, 0xaa78e300U,
+    0x35682000U, 0xb661f700U, 0xb5377500U, 0x363ea200U, 0xb39a7100U, 0x3093a600U,
+    0x33c52400U, 0xb0ccf300U, 0xbec07900U, 0x3dc9ae00U, 0x3e9f2c00U, 0xbd96fb00U,
+    0x38322800U, 0xbb3bff00U, 0xb86d7d00U, 0x3b64aa00U, 0xcea42900U, 0x4dadfe00U,
+    0x4efb7c00U, 0xcdf2ab00U, 0x48567800U, 0xcb5faf00U, 0xc8092d00U, 0x4b00fa00U,
+    0x450c7000U, 0xc605a700U, 0xc5532500U, 0x465af200U, 0xc3fe2100U, 0x40f7f600U,
+    0x43a17400U, 0xc0a8a300U, 0x5fb86000U, 0xdcb1b700U, 0xdfe73500U, 0x5ceee200U,
+    0xd94a3100U, 0x5a43e600U, 0x59156400U, 0xda1cb300U, 0xd4103900U, 0x5719ee00U,
+    0x544f6c00U, 0xd746bb00U, 0x52e26800U, 0xd1ebbf00U, 0xd2bd3d00U, 0x51b4ea00U,
+    0x6ad04000U, 0xe9d99700U, 0xea8f1500U, 0x6986c200U, 0xec221100U, 0x6f2bc600U,
+    0x6c7d4400U, 0xef749300U, 0xe1781900U, 0x6271ce00U, 0x61274c00U, 0xe22e9b00U,
+    0x678a4800U, 0xe4839f00U, 0xe7d51d00U, 0x64dcca00U, 0xfbcc0900U, 0x78c5de00U,
+    0x7b935c00U, 0xf89a8b00U, 0x7d3e5800U, 0xfe378f00U, 0xfd610d00U, 0x7e68da00U,
+    0x70645000U, 0xf36d8700U, 0xf03b0500U, 0x7332d200U, 0xf6960100U, 0x759fd600U,
+    0x76c95400U, 0xf5c08300U, 0x1b04a900U, 0x980d7e00U, 0x9b5bfc00U, 0x18522b00U,
+    0x9df6f800U, 0x1eff2f00U, 0x1da9ad00U, 0x9ea07a00U, 0x90acf000U, 0x13a52700U,
+    0x10f3a500U, 0x93fa7200U, 0x165ea100U, 0x95577600U, 0x9601f400U, 0x15082300U,
+    0x8a18e000U, 0x09113700U, 0x0a47b500U, 0x894e6200U, 0x0ceab100U, 0x8fe36600U,
+    0x8cb5e400U, 0x0fbc3300U, 0x01b0b900U, 0x82b96e00U, 0x81efec00U, 0x02e63b00U,
+    0x8742e800U, 0x044b3f00U, 0x071dbd00U, 0x84146a00U, 0xbf70c000U, 0x3c791700U,
+    0x3f2f9500U, 0xbc264200U, 0x39829100U, 0xba8b4600U, 0xb9ddc400U, 0x3ad41300U,
+    0x34d89900U, 0xb7d14e00U, 0xb487cc00U, 0x378e1b00U, 0xb22ac800U, 0x31231f00U,
+    0x32759d00U, 0xb17c4a00U, 0x2e6c8900U, 0xad655e00U, 0xae33dc00U, 0x2d3a0b00U,
+    0xa89ed800U, 0x2b970f00U, 0x28c18d00U, 0xabc85a00U, 0xa5c4d000U, 0x26cd0700U,
+    0x259b8500U, 0xa6925200U, 0x23368100U, 0xa03f5600U, 0xa369d400U, 0x20600300U,
+    0xd5a08000U, 0x56a95700U, 0x55ffd500U, 0xd6f60200U, 0x5352d100U, 0xd05b0600U,
+    0xd30d8400U, 0x50045300U, 0x5e08d900U, 0xdd010e00U, 0xde578c00U, 0x5d5e5b00U,
+    0xd8fa8800U, 0x5bf35f00U, 0x58a5dd00U, 0xdbac0a00U, 0x44bcc900U, 0xc7b51e00U,
+    0xc4e39c00U, 0x47ea4b00U, 0xc24e9800U, 0x41474f00U, 0x4211cd00U, 0xc1181a00U,
+    0xcf149000U, 0x4c1d4700U, 0x4f4bc500U, 0xcc421200U, 0x49e6c100U, 0xcaef1600U,
+    0xc9b99400U, 0x4ab04300U, 0x71d4e900U, 0xf2dd3e00U, 0xf18bbc00U, 0x72826b00U,
+    0xf726b800U, 0x742f6f00U, 0x7779ed00U, 0xf4703a00U, 0xfa7cb000U, 0x79756700U,
+    0x7a23e500U, 0xf92a3200U, 0x7c8ee100U, 0xff873600U, 0xfcd1b400U, 0x7fd86300U,
+    0xe0c8a000U, 0x63c17700U, 0x6097f500U, 0xe39e2200U, 0x663af100U, 0xe5332600U,
+    0xe665a400U, 0x656c7300U, 0x6b60f900U, 0xe8692e00U, 0xeb3fac00U, 0x68367b00U,
+    0xed92a800U, 0x6e9b7f00U, 0x6dcdfd00U, 0xeec42a00U
+  },
+  {
+    0x00000000U, 0x36095200U, 0x6c12a400U, 0x5a1bf600U, 0xd8254800U, 0xee2c1a00U,
+    0xb437ec00U, 0x823ebe00U, 0x36066b00U, 0x000f3900U, 0x5a14cf00U, 0x6c1d9d00U,
+    0xee232300U, 0xd82a7100U, 0x82318700U, 0xb438d500U, 0x6c0cd600U, 0x5a058400U,
+    0x001e7200U, 0x36172000U, 0xb4299e00U, 0x8220cc00U, 0xd83b3a00U, 0xee326800U,
+    0x5a0abd00U, 0x6c03ef00U, 0x36181900U, 0x00114b00U, 0x822ff500U, 0xb426a700U,
+    0xee3d5100U, 0xd8340300U, 0xd819ac00U, 0xee10fe00U, 0xb40b0800U, 0x82025a00U,
+    0x003ce400U, 0x3635b600U, 0x6c2e4000U, 0x5a271200U, 0xee1fc700U, 0xd8169500U,
+    0x820d6300U, 0xb4043100U, 0x363a8f00U, 0x0033dd00U, 0x5a282b00U, 0x6c217900U,
+    0xb4157a00U, 0x821c2800U, 0xd807de00U, 0xee0e8c00U, 0x6c303200U, 0x5a396000U,
+    0x00229600U, 0x362bc400U, 0x82131100U, 0xb41a4300U, 0xee01b500U, 0xd808e700U,
+    0x5a365900U, 0x6c3f0b00U, 0x3624fd00U, 0x002daf00U, 0x367fa300U, 0x0076f100U,
+    0x5a6d0700U, 0x6c645500U, 0xee5aeb00U, 0xd853b900U, 0x82484f00U, 0xb4411d00U,
+    0x0079c800U, 0x36709a00U, 0x6c6b6c00U, 0x5a623e00U, 0xd85c8000U, 0xee55d200U,
+    0xb44e2400U, 0x82477600U, 0x5a737500U, 0x6c7a2700U, 0x3661d100U, 0x00688300U,
+    0x82563d00U, 0xb45f6f00U, 0xee449900U, 0xd84dcb00U, 0x6c751e00U, 0x5a7c4c00U,
+    0x0067ba00U, 0x366ee800U, 0xb4505600U, 0x82590400U, 0xd842f200U, 0xee4ba000U,
+    0xee660f00U, 0xd86f5d00U, 0x8274ab00U, 0xb47df900U, 0x36434700U, 0x004a1500U,
+    0x5a51e300U, 0x6c58b100U, 0xd8606400U, 0xee693600U, 0xb472c000U, 0x827b9200U,
+    0x00452c00U, 0x364c7e00U, 0x6c578800U, 0x5a5eda00U, 0x826ad900U, 0xb4638b00U,
+    0xee787d00U, 0xd8712f00U, 0x5a4f9100U, 0x6c46c300U, 0x365d3500U, 0x00546700U,
+    0xb46cb200U, 0x8265e000U, 0xd87e1600U, 0xee774400U, 0x6c49fa00U, 0x5a40a800U,
+    0x005b5e00U, 0x36520c00U, 0x6cff4600U, 0x5af61400U, 0x00ede200U, 0x36e4b000U,
+    0xb4da0e00U, 0x82d35c00U, 0xd8c8aa00U, 0xeec1f800U, 0x5af92d00U, 0x6cf07f00U,
+    0x36eb8900U, 0x00e2db00U, 0x82dc6500U, 0xb4d53700U, 0xeecec100U, 0xd8c79300U,
+    0x00f39000U, 0x36fac200U, 0x6ce13400U, 0x5ae86600U, 0xd8d6d800U, 0xeedf8a00U,
+    0xb4c47c00U, 0x82cd2e00U, 0x36f5fb00U, 0x00fca900U, 0x5ae75f00U, 0x6cee0d00U,
+    0xeed0b300U, 0xd8d9e100U, 0x82c21700U, 0xb4cb4500U, 0xb4e6ea00U, 0x82efb800U,
+    0xd8f44e00U, 0xeefd1c00U, 0x6cc3a200U, 0x5acaf000U, 0x00d10600U, 0x36d85400U,
+    0x82e08100U, 0xb4e9d300U, 0xeef22500U, 0xd8fb7700U, 0x5ac5c900U, 0x6ccc9b00U,
+    0x36d76d00U, 0x00de3f00U, 0xd8ea3c00U, 0xeee36e00U, 0xb4f89800U, 0x82f1ca00U,
+    0x00cf7400U, 0x36c62600U, 0x6cddd000U, 0x5ad48200U, 0xeeec5700U, 0xd8e50500U,
+    0x82fef300U, 0xb4f7a100U, 0x36c91f00U, 0x00c04d00U, 0x5adbbb00U, 0x6cd2e900U,
+    0x5a80e500U, 0x6c89b700U, 0x36924100U, 0x009b1300U, 0x82a5ad00U, 0xb4acff00U,
+    0xeeb70900U, 0xd8be5b00U, 0x6c868e00U, 0x5a8fdc00U, 0x00942a00U, 0x369d7800U,
+    0xb4a3c600U, 0x82aa9400U, 0xd8b16200U, 0xeeb83000U, 0x368c3300U, 0x00856100U,
+    0x5a9e9700U, 0x6c97c500U, 0xeea97b00U, 0xd8a02900U, 0x82bbdf00U, 0xb4b28d00U,
+    0x008a5800U, 0x36830a00U, 0x6c98fc00U, 0x5a91ae00U, 0xd8af1000U, 0xeea64200U,
+    0xb4bdb400U, 0x82b4e600U, 0x82994900U, 0xb4901b00U, 0xee8bed00U, 0xd882bf00U,
+    0x5abc0100U, 0x6cb55300U, 0x36aea500U, 0x00a7f700U, 0xb49f2200U, 0x82967000U,
+    0xd88d8600U, 0xee84d400U, 0x6cba6a00U, 0x5ab33800U, 0x00a8ce00U, 0x36a19c00U,
+    0xee959f00U, 0xd89ccd00U, 0x82873b00U, 0xb48e6900U, 0x36b0d700U, 0x00b98500U,
+    0x5aa27300U, 0x6cab2100U, 0xd893f400U, 0xee9aa600U, 0xb4815000U, 0x82880200U,
+    0x00b6bc00U, 0x36bfee00U, 0x6ca41800U, 0x5aad4a00U
+  },
+  {
+    0x00000000U, 0xd9fe8c00U, 0x35b1e300U, 0xec4f6f00U, 0x6b63c600U, 0xb29d4a00U,
+    0x5ed22500U, 0x872ca900U, 0xd6c78c00U, 0x0f390000U, 0xe3766f00U, 0x3a88e300U,
+    0xbda44a00U, 0x645ac600U, 0x8815a900U, 0x51eb2500U, 0x2bc3e300U, 0xf23d6f00U,
+    0x1e720000U, 0xc78c8c00U, 0x40a02500U, 0x995ea900U, 0x7511c600U, 0xacef4a00U,
+    0xfd046f00U, 0x24fae300U, 0xc8b58c00U, 0x114b0000U, 0x9667a900U, 0x4f992500U,
+    0xa3d64a00U, 0x7a28c600U, 0x5787c600U, 0x8e794a00U, 0x62362500U, 0xbbc8a900U,
+    0x3ce40000U, 0xe51a8c00U, 0x0955e300U, 0xd0ab6f00U, 0x81404a00U, 0x58bec600U,
+    0xb4f1a900U, 0x6d0f2500U, 0xea238c00U, 0x33dd0000U, 0xdf926f00U, 0x066ce300U,
+    0x7c442500U, 0xa5baa900U, 0x49f5c600U, 0x900b4a00U, 0x1727e300U, 0xced96f00U,
+    0x22960000U, 0xfb688c00U, 0xaa83a900U, 0x737d2500U, 0x9f324a00U, 0x46ccc600U,
+    0xc1e06f00U, 0x181ee300U, 0xf4518c00U, 0x2daf0000U, 0xaf0f8c00U, 0x76f10000U,
+    0x9abe6f00U, 0x4340e300U, 0xc46c4a00U, 0x1d92c600U, 0xf1dda900U, 0x28232500U,
+    0x79c80000U, 0xa0368c00U, 0x4c79e300U, 0x95876f00U, 0x12abc600U, 0xcb554a00U,
+    0x271a2500U, 0xfee4a900U, 0x84cc6f00U, 0x5d32e300U, 0xb17d8c00U, 0x68830000U,
+    0xefafa900U, 0x36512500U, 0xda1e4a00U, 0x03e0c600U, 0x520be300U, 0x8bf56f00U,
+    0x67ba0000U, 0xbe448c00U, 0x39682500U, 0xe096a900U, 0x0cd9c600U, 0xd5274a00U,
+    0xf8884a00U, 0x2176c600U, 0xcd39a900U, 0x14c72500U, 0x93eb8c00U, 0x4a150000U,
+    0xa65a6f00U, 0x7fa4e300U, 0x2e4fc600U, 0xf7b14a00U, 0x1bfe2500U, 0xc200a900U,
+    0x452c0000U, 0x9cd28c00U, 0x709de300U, 0xa9636f00U, 0xd34ba900U, 0x0ab52500U,
+    0xe6fa4a00U, 0x3f04c600U, 0xb8286f00U, 0x61d6e300U, 0x8d998c00U, 0x54670000U,
+    0x058c2500U, 0xdc72a900U, 0x303dc600U, 0xe9c34a00U, 0x6eefe300U, 0xb7116f00U,
+    0x5b5e0000U, 0x82a08c00U, 0xd853e300U, 0x01ad6f00U, 0xede20000U, 0x341c8c00U,
+    0xb3302500U, 0x6acea900U, 0x8681c600U, 0x5f7f4a00U, 0x0e946f00U, 0xd76ae300U,
+    0x3b258c00U, 0xe2db0000U, 0x65f7a900U, 0xbc092500U, 0x50464a00U, 0x89b8c600U,
+    0xf3900000U, 0x2a6e8c00U, 0xc621e300U, 0x1fdf6f00U, 0x98f3c600U, 0x410d4a00U,
+    0xad422500U, 0x74bca900U, 0x25578c00U, 0xfca90000U, 0x10e66f00U, 0xc918e300U,
+    0x4e344a00U, 0x97cac600U, 0x7b85a900U, 0xa27b2500U, 0x8fd42500U, 0x562aa900U,
+    0xba65c600U, 0x639b4a00U, 0xe4b7e300U, 0x3d496f00U, 0xd1060000U, 0x08f88c00U,
+    0x5913a900U, 0x80ed2500U, 0x6ca24a00U, 0xb55cc600U, 0x32706f00U, 0xeb8ee300U,
+    0x07c18c00U, 0xde3f0000U, 0xa417c600U, 0x7de94a00U, 0x91a62500U, 0x4858a900U,
+    0xcf740000U, 0x168a8c00U, 0xfac5e300U, 0x233b6f00U, 0x72d04a00U, 0xab2ec600U,
+    0x4761a900U, 0x9e9f2500U, 0x19b38c00U, 0xc04d0000U, 0x2c026f00U, 0xf5fce300U,
+    0x775c6f00U, 0xaea2e300U, 0x42ed8c00U, 0x9b130000U, 0x1c3fa900U, 0xc5c12500U,
+    0x298e4a00U, 0xf070c600U, 0xa19be300U, 0x78656f00U, 0x942a0000U, 0x4dd48c00U,
+    0xcaf82500U, 0x1306a900U, 0xff49c600U, 0x26b74a00U, 0x5c9f8c00U, 0x85610000U,
+    0x692e6f00U, 0xb0d0e300U, 0x37fc4a00U, 0xee02c600U, 0x024da900U, 0xdbb32500U,
+    0x8a580000U, 0x53a68c00U, 0xbfe9e300U, 0x66176f00U, 0xe13bc600U, 0x38c54a00U,
+    0xd48a2500U, 0x0d74a900U, 0x20dba900U, 0xf9252500U, 0x156a4a00U, 0xcc94c600U,
+    0x4bb86f00U, 0x9246e300U, 0x7e098c00U, 0xa7f70000U, 0xf61c2500U, 0x2fe2a900U,
+    0xc3adc600U, 0x1a534a00U, 0x9d7fe300U, 0x44816f00U, 0xa8ce0000U, 0x71308c00U,
+    0x0b184a00U, 0xd2e6c600U, 0x3ea9a900U, 0xe7572500U, 0x607b8c00U, 0xb9850000U,
+    0x55ca6f00U, 0x8c34e300U, 0xdddfc600U, 0x04214a00U, 0xe86e2500U, 0x3190a900U,
+    0xb6bc0000U, 0x6f428c00U, 0x830de300U, 0x5af36f00U
+  },
+  {
+    0x00000000U, 0x36eb3d00U, 0x6dd67a00U, 0x5b3d4700U, 0xdbacf400U, 0xed47c900U,
+    0xb67a8e00U, 0x8091b300U, 0x31151300U, 0x07fe2e00U, 0x5cc36900U, 0x6a285400U,
+    0xeab9e700U, 0xdc52da00U, 0x876f9d00U, 0xb184a000U, 0x622a2600U, 0x54c11b00U,
+    0x0ffc5c00U, 0x39176100U, 0xb986d200U, 0x8f6def00U, 0xd450a800U, 0xe2bb9500U,
+    0x533f3500U, 0x65d40800U, 0x3ee94f00U, 0x08027200U, 0x8893c100U, 0xbe78fc00U,
+    0xe545bb00U, 0xd3ae8600U, 0xc4544c00U, 0xf2bf7100U, 0xa9823600U, 0x9f690b00U,
+    0x1ff8b800U, 0x29138500U, 0x722ec200U, 0x44c5ff00U, 0xf5415f00U, 0xc3aa6200U,
+    0x98972500U, 0xae7c1800U, 0x2eedab00U, 0x18069600U, 0x433bd100U, 0x75d0ec00U,
+    0xa67e6a00U, 0x90955700U, 0xcba81000U, 0xfd432d00U, 0x7dd29e00U, 0x4b39a300U,
+    0x1004e400U, 0x26efd900U, 0x976b7900U, 0xa1804400U, 0xfabd0300U, 0xcc563e00U,
+    0x4cc78d00U, 0x7a2cb000U, 0x2111f700U, 0x17faca00U, 0x0ee46300U, 0x380f5e00U,
+    0x63321900U, 0x55d92400U, 0xd5489700U, 0xe3a3aa00U, 0xb89eed00U, 0x8e75d000U,
+    0x3ff17000U, 0x091a4d00U, 0x52270a00U, 0x64cc3700U, 0xe45d8400U, 0xd2b6b900U,
+    0x898bfe00U, 0xbf60c300U, 0x6cce4500U, 0x5a257800U, 0x01183f00U, 0x37f30200U,
+    0xb762b100U, 0x81898c00U, 0xdab4cb00U, 0xec5ff600U, 0x5ddb5600U, 0x6b306b00U,
+    0x300d2c00U, 0x06e61100U, 0x8677a200U, 0xb09c9f00U, 0xeba1d800U, 0xdd4ae500U,
+    0xcab02f00U, 0xfc5b1200U, 0xa7665500U, 0x918d6800U, 0x111cdb00U, 0x27f7e600U,
+    0x7ccaa100U, 0x4a219c00U, 0xfba53c00U, 0xcd4e0100U, 0x96734600U, 0xa0987b00U,
+    0x2009c800U, 0x16e2f500U, 0x4ddfb200U, 0x7b348f00U, 0xa89a0900U, 0x9e713400U,
+    0xc54c7300U, 0xf3a74e00U, 0x7336fd00U, 0x45ddc000U, 0x1ee08700U, 0x280bba00U,
+    0x998f1a00U, 0xaf642700U, 0xf4596000U, 0xc2b25d00U, 0x4223ee00U, 0x74c8d300U,
+    0x2ff59400U, 0x191ea900U, 0x1dc8c600U, 0x2b23fb00U, 0x701ebc00U, 0x46f58100U,
+    0xc6643200U, 0xf08f0f00U, 0xabb24800U, 0x9d597500U, 0x2cddd500U, 0x1a36e800U,
+    0x410baf00U, 0x77e09200U, 0xf7712100U, 0xc19a1c00U, 0x9aa75b00U, 0xac4c6600U,
+    0x7fe2e000U, 0x4909dd00U, 0x12349a00U, 0x24dfa700U, 0xa44e1400U, 0x92a52900U,
+    0xc9986e00U, 0xff735300U, 0x4ef7f300U, 0x781cce00U, 0x23218900U, 0x15cab400U,
+    0x955b0700U, 0xa3b03a00U, 0xf88d7d00U, 0xce664000U, 0xd99c8a00U, 0xef77b700U,
+    0xb44af000U, 0x82a1cd00U, 0x02307e00U, 0x34db4300U, 0x6fe60400U, 0x590d3900U,
+    0xe8899900U, 0xde62a400U, 0x855fe300U, 0xb3b4de00U, 0x33256d00U, 0x05ce5000U,
+    0x5ef31700U, 0x68182a00U, 0xbbb6ac00U, 0x8d5d9100U, 0xd660d600U, 0xe08beb00U,
+    0x601a5800U, 0x56f16500U, 0x0dcc2200U, 0x3b271f00U, 0x8aa3bf00U, 0xbc488200U,
+    0xe775c500U, 0xd19ef800U, 0x510f4b00U, 0x67e47600U, 0x3cd93100U, 0x0a320c00U,
+    0x132ca500U, 0x25c79800U, 0x7efadf00U, 0x4811e200U, 0xc8805100U, 0xfe6b6c00U,
+    0xa5562b00U, 0x93bd1600U, 0x2239b600U, 0x14d28b00U, 0x4fefcc00U, 0x7904f100U,
+    0xf9954200U, 0xcf7e7f00U, 0x94433800U, 0xa2a80500U, 0x71068300U, 0x47edbe00U,
+    0x1cd0f900U, 0x2a3bc400U, 0xaaaa7700U, 0x9c414a00U, 0xc77c0d00U, 0xf1973000U,
+    0x40139000U, 0x76f8ad00U, 0x2dc5ea00U, 0x1b2ed700U, 0x9bbf6400U, 0xad545900U,
+    0xf6691e00U, 0xc0822300U, 0xd778e900U, 0xe193d400U, 0xbaae9300U, 0x8c45ae00U,
+    0x0cd41d00U, 0x3a3f2000U, 0x61026700U, 0x57e95a00U, 0xe66dfa00U, 0xd086c700U,
+    0x8bbb8000U, 0xbd50bd00U, 0x3dc10e00U, 0x0b2a3300U, 0x50177400U, 0x66fc4900U,
+    0xb552cf00U, 0x83b9f200U, 0xd884b500U, 0xee6f8800U, 0x6efe3b00U, 0x58150600U,
+    0x03284100U, 0x35c37c00U, 0x8447dc00U, 0xb2ace100U, 0xe991a600U, 0xdf7a9b00U,
+    0x5feb2800U, 0x69001500U, 0x323d5200U, 0x04d66f00U
+  },
+  {
+    0x00000000U, 0x3b918c00U, 0x77231800U, 0x4cb29400U, 0xee463000U, 0xd5d7bc00U,
+    0x99652800U, 0xa2f4a400U, 0x5ac09b00U, 0x61511700U, 0x2de38300U, 0x16720f00U,
+    0xb486ab00U, 0x8f172700U, 0xc3a5b300U, 0xf8343f00U, 0xb5813600U, 0x8e10ba00U,
+    0xc2a22e00U, 0xf933a200U, 0x5bc70600U, 0x60568a00U, 0x2ce41e00U, 0x17759200U,
+    0xef41ad00U, 0xd4d02100U, 0x9862b500U, 0xa3f33900U, 0x01079d00U, 0x3a961100U,
+    0x76248500U, 0x4db50900U, 0xed4e9700U, 0xd6df1b00U, 0x9a6d8f00U, 0xa1fc0300U,
+    0x0308a700U, 0x38992b00U, 0x742bbf00U, 0x4fba3300U, 0xb78e0c00U, 0x8c1f8000U,
+    0xc0ad1400U, 0xfb3c9800U, 0x59c83c00U, 0x6259b000U, 0x2eeb2400U, 0x157aa800U,
+    0x58cfa100U, 0x635e2d00U, 0x2fecb900U, 0x147d3500U, 0xb6899100U, 0x8d181d00U,
+    0xc1aa8900U, 0xfa3b0500U, 0x020f3a00U, 0x399eb600U, 0x752c2200U, 0x4ebdae00U,
+    0xec490a00U, 0xd7d88600U, 0x9b6a1200U, 0xa0fb9e00U, 0x5cd1d500U, 0x67405900U,
+    0x2bf2cd00U, 0x10634100U, 0xb297e500U, 0x89066900U, 0xc5b4fd00U, 0xfe257100U,
+    0x06114e00U, 0x3d80c200U, 0x71325600U, 0x4aa3da00U, 0xe8577e00U, 0xd3c6f200U,
+    0x9f746600U, 0xa4e5ea00U, 0xe950e300U, 0xd2c16f00U, 0x9e73fb00U, 0xa5e27700U,
+    0x0716d300U, 0x3c875f00U, 0x7035cb00U, 0x4ba44700U, 0xb3907800U, 0x8801f400U,
+    0xc4b36000U, 0xff22ec00U, 0x5dd64800U, 0x6647c400U, 0x2af55000U, 0x1164dc00U,
+    0xb19f4200U, 0x8a0ece00U, 0xc6bc5a00U, 0xfd2dd600U, 0x5fd97200U, 0x6448fe00U,
+    0x28fa6a00U, 0x136be600U, 0xeb5fd900U, 0xd0ce5500U, 0x9c7cc100U, 0xa7ed4d00U,
+    0x0519e900U, 0x3e886500U, 0x723af100U, 0x49ab7d00U, 0x041e7400U, 0x3f8ff800U,
+    0x733d6c00U, 0x48ace000U, 0xea584400U, 0xd1c9c800U, 0x9d7b5c00U, 0xa6ead000U,
+    0x5edeef00U, 0x654f6300U, 0x29fdf700U, 0x126c7b00U, 0xb098df00U, 0x8b095300U,
+    0xc7bbc700U, 0xfc2a4b00U, 0xb9a3aa00U, 0x82322600U, 0xce80b200U, 0xf5113e00U,
+    0x57e59a00U, 0x6c741600U, 0x20c68200U, 0x1b570e00U, 0xe3633100U, 0xd8f2bd00U,
+    0x94402900U, 0xafd1a500U, 0x0d250100U, 0x36b48d00U, 0x7a061900U, 0x41979500U,
+    0x0c229c00U, 0x37b31000U, 0x7b018400U, 0x40900800U, 0xe264ac00U, 0xd9f52000U,
+    0x9547b400U, 0xaed63800U, 0x56e20700U, 0x6d738b00U, 0x21c11f00U, 0x1a509300U,
+    0xb8a43700U, 0x8335bb00U, 0xcf872f00U, 0xf416a300U, 0x54ed3d00U, 0x6f7cb100U,
+    0x23ce2500U, 0x185fa900U, 0xbaab0d00U, 0x813a8100U, 0xcd881500U, 0xf6199900U,
+    0x0e2da600U, 0x35bc2a00U, 0x790ebe00U, 0x429f3200U, 0xe06b9600U, 0xdbfa1a00U,
+    0x97488e00U, 0xacd90200U, 0xe16c0b00U, 0xdafd8700U, 0x964f1300U, 0xadde9f00U,
+    0x0f2a3b00U, 0x34bbb700U, 0x78092300U, 0x4398af00U, 0xbbac9000U, 0x803d1c00U,
+    0xcc8f8800U, 0xf71e0400U, 0x55eaa000U, 0x6e7b2c00U, 0x22c9b800U, 0x19583400U,
+    0xe5727f00U, 0xdee3f300U, 0x92516700U, 0xa9c0eb00U, 0x0b344f00U, 0x30a5c300U,
+    0x7c175700U, 0x4786db00U, 0xbfb2e400U, 0x84236800U, 0xc891fc00U, 0xf3007000U,
+    0x51f4d400U, 0x6a655800U, 0x26d7cc00U, 0x1d464000U, 0x50f34900U, 0x6b62c500U,
+    0x27d05100U, 0x1c41dd00U, 0xbeb57900U, 0x8524f500U, 0xc9966100U, 0xf207ed00U,
+    0x0a33d200U, 0x31a25e00U, 0x7d10ca00U, 0x46814600U, 0xe475e200U, 0xdfe46e00U,
+    0x9356fa00U, 0xa8c77600U, 0x083ce800U, 0x33ad6400U, 0x7f1ff000U, 0x448e7c00U,
+    0xe67ad800U, 0xddeb5400U, 0x9159c000U, 0xaac84c00U, 0x52fc7300U, 0x696dff00U,
+    0x25df6b00U, 0x1e4ee700U, 0xbcba4300U, 0x872bcf00U, 0xcb995b00U, 0xf008d700U,
+    0xbdbdde00U, 0x862c5200U, 0xca9ec600U, 0xf10f4a00U, 0x53fbee00U, 0x686a6200U,
+    0x24d8f600U, 0x1f497a00U, 0xe77d4500U, 0xdcecc900U, 0x905e5d00U, 0xabcfd100U,
+    0x093b7500U, 0x32aaf900U, 0x7e186d00U, 0x4589e100U
+  },
+  {
+    0x00000000U, 0xf50baf00U, 0x6c5ba500U, 0x99500a00U, 0xd8b74a00U, 0x2dbce500U,
+    0xb4ecef00U, 0x41e74000U, 0x37226f00U, 0xc229c000U, 0x5b79ca00U, 0xae726500U,
+    0xef952500U, 0x1a9e8a00U, 0x83ce8000U, 0x76c52f00U, 0x6e44de00U, 0x9b4f7100U,
+    0x021f7b00U, 0xf714d400U, 0xb6f39400U, 0x43f83b00U, 0xdaa83100U, 0x2fa39e00U,
+    0x5966b100U, 0xac6d1e00U, 0x353d1400U, 0xc036bb00U, 0x81d1fb00U, 0x74da5400U,
+    0xed8a5e00U, 0x1881f100U, 0xdc89bc00U, 0x29821300U, 0xb0d21900U, 0x45d9b600U,
+    0x043ef600U, 0xf1355900U, 0x68655300U, 0x9d6efc00U, 0xebabd300U, 0x1ea07c00U,
+    0x87f07600U, 0x72fbd900U, 0x331c9900U, 0xc6173600U, 0x5f473c00U, 0xaa4c9300U,
+    0xb2cd6200U, 0x47c6cd00U, 0xde96c700U, 0x2b9d6800U, 0x6a7a2800U, 0x9f718700U,
+    0x06218d00U, 0xf32a2200U, 0x85ef0d00U, 0x70e4a200U, 0xe9b4a800U, 0x1cbf0700U,
+    0x5d584700U, 0xa853e800U, 0x3103e200U, 0xc4084d00U, 0x3f5f8300U, 0xca542c00U,
+    0x53042600U, 0xa60f8900U, 0xe7e8c900U, 0x12e36600U, 0x8bb36c00U, 0x7eb8c300U,
+    0x087dec00U, 0xfd764300U, 0x64264900U, 0x912de600U, 0xd0caa600U, 0x25c10900U,
+    0xbc910300U, 0x499aac00U, 0x511b5d00U, 0xa410f200U, 0x3d40f800U, 0xc84b5700U,
+    0x89ac1700U, 0x7ca7b800U, 0xe5f7b200U, 0x10fc1d00U, 0x66393200U, 0x93329d00U,
+    0x0a629700U, 0xff693800U, 0xbe8e7800U, 0x4b85d700U, 0xd2d5dd00U, 0x27de7200U,
+    0xe3d63f00U, 0x16dd9000U, 0x8f8d9a00U, 0x7a863500U, 0x3b617500U, 0xce6ada00U,
+    0x573ad000U, 0xa2317f00U, 0xd4f45000U, 0x21ffff00U, 0xb8aff500U, 0x4da45a00U,
+    0x0c431a00U, 0xf948b500U, 0x6018bf00U, 0x95131000U, 0x8d92e100U, 0x78994e00U,
+    0xe1c94400U, 0x14c2eb00U, 0x5525ab00U, 0xa02e0400U, 0x397e0e00U, 0xcc75a100U,
+    0xbab08e00U, 0x4fbb2100U, 0xd6eb2b00U, 0x23e08400U, 0x6207c400U, 0x970c6b00U,
+    0x0e5c6100U, 0xfb57ce00U, 0x7ebf0600U, 0x8bb4a900U, 0x12e4a300U, 0xe7ef0c00U,
+    0xa6084c00U, 0x5303e300U, 0xca53e900U, 0x3f584600U, 0x499d6900U, 0xbc96c600U,
+    0x25c6cc00U, 0xd0cd6300U, 0x912a2300U, 0x64218c00U, 0xfd718600U, 0x087a2900U,
+    0x10fbd800U, 0xe5f07700U, 0x7ca07d00U, 0x89abd200U, 0xc84c9200U, 0x3d473d00U,
+    0xa4173700U, 0x511c9800U, 0x27d9b700U, 0xd2d21800U, 0x4b821200U, 0xbe89bd00U,
+    0xff6efd00U, 0x0a655200U, 0x93355800U, 0x663ef700U, 0xa236ba00U, 0x573d1500U,
+    0xce6d1f00U, 0x3b66b000U, 0x7a81f000U, 0x8f8a5f00U, 0x16da5500U, 0xe3d1fa00U,
+    0x9514d500U, 0x601f7a00U, 0xf94f7000U, 0x0c44df00U, 0x4da39f00U, 0xb8a83000U,
+    0x21f83a00U, 0xd4f39500U, 0xcc726400U, 0x3979cb00U, 0xa029c100U, 0x55226e00U,
+    0x14c52e00U, 0xe1ce8100U, 0x789e8b00U, 0x8d952400U, 0xfb500b00U, 0x0e5ba400U,
+    0x970bae00U, 0x62000100U, 0x23e74100U, 0xd6ecee00U, 0x4fbce400U, 0xbab74b00U,
+    0x41e08500U, 0xb4eb2a00U, 0x2dbb2000U, 0xd8b08f00U, 0x9957cf00U, 0x6c5c6000U,
+    0xf50c6a00U, 0x0007c500U, 0x76c2ea00U, 0x83c94500U, 0x1a994f00U, 0xef92e000U,
+    0xae75a000U, 0x5b7e0f00U, 0xc22e0500U, 0x3725aa00U, 0x2fa45b00U, 0xdaaff400U,
+    0x43fffe00U, 0xb6f45100U, 0xf7131100U, 0x0218be00U, 0x9b48b400U, 0x6e431b00U,
+    0x18863400U, 0xed8d9b00U, 0x74dd9100U, 0x81d63e00U, 0xc0317e00U, 0x353ad100U,
+    0xac6adb00U, 0x59617400U, 0x9d693900U, 0x68629600U, 0xf1329c00U, 0x04393300U,
+    0x45de7300U, 0xb0d5dc00U, 0x2985d600U, 0xdc8e7900U, 0xaa4b5600U, 0x5f40f900U,
+    0xc610f300U, 0x331b5c00U, 0x72fc1c00U, 0x87f7b300U, 0x1ea7b900U, 0xebac1600U,
+    0xf32de700U, 0x06264800U, 0x9f764200U, 0x6a7ded00U, 0x2b9aad00U, 0xde910200U,
+    0x47c10800U, 0xb2caa700U, 0xc40f8800U, 0x31042700U, 0xa8542d00U, 0x5d5f8200U,
+    0x1cb8c200U, 0xe9b36d00U, 0x70e36700U, 0x85e8c800U
+  }
+};
+
+uint32_t crc24q(long size, const unsigned char *buf)
+{
+  uint32_t crc = 0;
+
+  while(size >= 8)
+  {
+    crc ^= ((uint32_t)buf[0]<<24)|((uint32_t)buf[1]<<16)
+         | ((uint32_t)buf[2]<<8)|buf[3];
+    crc = crc24qtab[7][crc>>24]        ^ crc24qtab[6][(crc>>16)&0xFF]
+        ^ crc24qtab[5][(crc>>8)&0xFF]  ^ crc24qtab[4][crc&0xFF]
+        ^ crc24qtab[3][buf[4]]         ^ crc24qtab[2][buf[5]]
+        ^ crc24qtab[1][buf[6]]         ^ crc24qtab[0][buf[7]];
+    buf  += 8;
+    size -= 8;
+  }
+  while(size-- > 0)
+    crc = (crc<<8) ^ crc24qtab[0][(crc>>24) ^ *buf++];
+
+  return crc>>8;
+}
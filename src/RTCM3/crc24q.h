@@ -0,0 +1,30 @@
+#ifndef RTCM3_CRC24Q_H
+#define RTCM3_CRC24Q_H
+
+/* Programheader
+
+        Name:           crc24q.h
+        Project:        RTCM3
+        Description:    table driven CRC24Q checksum (slicing-by-8)
+*/
+
+#ifndef sparc
+#include <stdint.h>
+#else
+#include <sys/types.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CRC24Q checksum calculation function (only full bytes supported).
+   Bit exact replacement of the classic bit-at-a-time loop, processing
+   8 bytes per step with 8 lookup tables. */
+uint32_t crc24q(long size, const unsigned char *buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTCM3_CRC24Q_H */
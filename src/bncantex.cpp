@@ -24,6 +24,7 @@
 
 
 
+#include <cmath>
 #include <iostream>
 #include <newmat/newmatio.h>
 
@@ -35,6 +36,48 @@ using namespace std;
 
 using namespace NEWMAT;
 
+QMutex                                     bncAntex::_sharedMutex;
+QMap<QString, QWeakPointer<const bncAntex> > bncAntex::_sharedMaps;
+
+// Shared Instance (one parse per file and modification time)
+////////////////////////////////////////////////////////////////////////////
+QSharedPointer<const bncAntex> bncAntex::shared(const QString& fileName) {
+
+  QFileInfo info(fileName);
+  QString key = info.canonicalFilePath();
+  if (key.isEmpty()) {
+    key = fileName;
+  }
+  key += '|' + info.lastModified().toString(Qt::ISODate);
+
+  QMutexLocker locker(&_sharedMutex);
+
+  QSharedPointer<const bncAntex> antex = _sharedMaps.value(key).toStrongRef();
+  if (antex) {
+    return antex;
+  }
+
+  bncAntex* newAntex = new bncAntex();
+  if (newAntex->readFile(fileName) != success) {
+    delete newAntex;
+    return QSharedPointer<const bncAntex>();
+  }
+  antex = QSharedPointer<const bncAntex>(newAntex);
+
+  // Forget entries whose last user has gone
+  // ---------------------------------------
+  QMutableMapIterator<QString, QWeakPointer<const bncAntex> > it(_sharedMaps);
+  while (it.hasNext()) {
+    it.next();
+    if (it.value().isNull()) {
+      it.remove();
+    }
+  }
+  _sharedMaps[key] = antex;
+
+  return antex;
+}
+
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
 bncAntex::bncAntex() {
@@ -78,25 +121,40 @@ void bncAntex::print() const {
   }
 }
 
-// Print
+// Find Frequency Map (read-only lookup, no detach of the shared maps)
 ////////////////////////////////////////////////////////////////////////////
-QString bncAntex::pcoSinexString(const std::string& antName, t_frequency::type frqType) {
+const bncAntex::t_frqMap* bncAntex::findFrqMap(const QString& antName,
+                                               t_frequency::type frqType,
+                                               const t_antMap** antMap) const {
 
-  if (antName.find("NULLANTENNA") != string::npos) {
-    return QString(" ------ ------ ------");
+  QMap<QString, t_antMap*>::const_iterator itAnt = _maps.constFind(antName);
+  if (itAnt == _maps.constEnd()) {
+    return 0;
   }
+  const t_antMap* map = itAnt.value();
 
-  QString antNameQ = antName.c_str();
-  if (_maps.find(antNameQ) == _maps.end()) {
-    return QString(" ------ ------ ------");
+  QMap<t_frequency::type, t_frqMap*>::const_iterator itFrq = map->frqMap.constFind(frqType);
+  if (itFrq == map->frqMap.constEnd()) {
+    return 0;
   }
+  if (antMap) {
+    *antMap = map;
+  }
+  return itFrq.value();
+}
 
-  t_antMap* map = _maps[antNameQ];
-  if (map->frqMap.find(frqType) == map->frqMap.end()) {
+// Print
+////////////////////////////////////////////////////////////////////////////
+QString bncAntex::pcoSinexString(const std::string& antName, t_frequency::type frqType) const {
+
+  if (antName.find("NULLANTENNA") != string::npos) {
     return QString(" ------ ------ ------");
   }
 
-  t_frqMap* frqMap = map->frqMap[frqType];
+  const t_frqMap* frqMap = findFrqMap(QString(antName.c_str()), frqType);
+  if (!frqMap) {
+    return QString(" ------ ------ ------");
+  }
 
   QString u, n,e;
   u.sprintf("%+6.4f" ,frqMap->neu[2]); if (u.mid(1,1) == "0") {u.remove(1,1);}
@@ -169,6 +227,16 @@ t_irc bncAntex::readFile(const QString& fileName) {
       else if (line.indexOf("ZEN1 / ZEN2 / DZEN") == 60) {
         QTextStream inLine(&line, QIODevice::ReadOnly);
         inLine >> newAntMap->zen1 >> newAntMap->zen2 >> newAntMap->dZen;
+        if (newAntMap->dZen > 0.0) {
+          newAntMap->nZen = int((newAntMap->zen2-newAntMap->zen1)/newAntMap->dZen + 0.5) + 1;
+        }
+      }
+      else if (line.indexOf("DAZI") == 60) {
+        QTextStream inLine(&line, QIODevice::ReadOnly);
+        inLine >> newAntMap->dAzi;
+        if (newAntMap->dAzi > 0.0) {
+          newAntMap->nAzi = int(360.0/newAntMap->dAzi + 0.5) + 1;
+        }
       }
 
       // Start of Frequency
@@ -237,6 +305,12 @@ t_irc bncAntex::readFile(const QString& fileName) {
           else if (line.indexOf("C07") == 3) {
             frqType = t_frequency::C7;
           }
+          // Without azimuth-dependent rows the grid is the NOAZI row only
+          // ----------------------------------------------------------
+          if (newFrqMap->aziPattern.empty() && newFrqMap->pattern.Nrows() > 0) {
+            newFrqMap->aziPattern.assign(newFrqMap->pattern.Store(),
+                                         newFrqMap->pattern.Store() + newFrqMap->pattern.Nrows());
+          }
           if (frqType != t_frequency::dummy) {
             if (newAntMap->frqMap.find(frqType) != newAntMap->frqMap.end()) {
               delete newAntMap->frqMap[frqType];
@@ -266,7 +340,7 @@ t_irc bncAntex::readFile(const QString& fileName) {
         }
         else if (line.indexOf("NOAZI") == 3) {
           QTextStream inLine(&line, QIODevice::ReadOnly);
-          int nPat = int((newAntMap->zen2-newAntMap->zen1)/newAntMap->dZen) + 1;
+          int nPat = newAntMap->nZen;
           newFrqMap->pattern.ReSize(nPat);
           QString dummy;
           inLine >> dummy;
@@ -276,6 +350,22 @@ t_irc bncAntex::readFile(const QString& fileName) {
           }
           newFrqMap->pattern *= 1e-3;
         }
+        else if (newAntMap->nAzi > 1 && newAntMap->nZen > 0 && newFrqMap->pattern.Nrows() > 0) {
+          QTextStream inLine(&line, QIODevice::ReadOnly);
+          double azi = -1.0;
+          inLine >> azi;
+          int iAzi = int(azi/newAntMap->dAzi + 0.5);
+          if (inLine.status() == QTextStream::Ok && azi >= 0.0 && iAzi < newAntMap->nAzi) {
+            if (newFrqMap->aziPattern.empty()) {
+              newFrqMap->aziPattern.assign(newAntMap->nAzi * newAntMap->nZen, 0.0);
+            }
+            double* row = &newFrqMap->aziPattern[iAzi * newAntMap->nZen];
+            for (int ii = 0; ii < newAntMap->nZen; ii++) {
+              inLine >> row[ii];
+              row[ii] *= 1e-3;
+            }
+          }
+        }
       }
     }
   }
@@ -289,7 +379,7 @@ t_irc bncAntex::readFile(const QString& fileName) {
 // Satellite Antenna Offset
 ////////////////////////////////////////////////////////////////////////////
 t_irc bncAntex::satCoMcorrection(const QString& prn, double Mjd,
-                                 const ColumnVector& xSat, ColumnVector& dx)
+                                 const ColumnVector& xSat, ColumnVector& dx) const
 {
   t_frequency::type frqType = t_frequency::dummy;
 
@@ -300,84 +390,123 @@ t_irc bncAntex::satCoMcorrection(const QString& prn, double Mjd,
     frqType = t_frequency::R1;
   }
 
-  QMap<QString, t_antMap*>::const_iterator it = _maps.find(prn.mid(0,3));
-  if (it != _maps.end()) {
-    t_antMap* map = it.value();
-    if (map->frqMap.find(frqType) != map->frqMap.end()) {
-
-      double* neu = map->frqMap[frqType]->neu;
+  const t_frqMap* frqMap = findFrqMap(prn.mid(0,3), frqType);
+  if (!frqMap) {
+    return failure;
+  }
 
-      // Unit Vectors sz, sy, sx
-      // -----------------------
-      ColumnVector sz = -xSat;
-      sz /= sqrt(DotProduct(sz,sz));
+  const double* neu = frqMap->neu;
 
-      ColumnVector xSun = BNC_PPP::t_astro::Sun(Mjd);
-      xSun /= sqrt(DotProduct(xSun,xSun));
+  // Unit Vectors sz, sy, sx
+  // -----------------------
+  ColumnVector sz = -xSat;
+  sz /= sqrt(DotProduct(sz,sz));
 
-      ColumnVector sy = crossproduct(sz, xSun);
-      sy /= sqrt(DotProduct(sy,sy));
+  ColumnVector xSun = BNC_PPP::t_astro::Sun(Mjd);
+  xSun /= sqrt(DotProduct(xSun,xSun));
 
-      ColumnVector sx = crossproduct(sy, sz);
+  ColumnVector sy = crossproduct(sz, xSun);
+  sy /= sqrt(DotProduct(sy,sy));
 
-      //dx[0] = sx[0] * neu[0] + sy[0] * neu[1] + sz[0] * neu[2];
-      //dx[1] = sx[1] * neu[0] + sy[1] * neu[1] + sz[1] * neu[2];
-      //dx[2] = sx[2] * neu[0] + sy[2] * neu[1] + sz[2] * neu[2];
+  ColumnVector sx = crossproduct(sy, sz);
 
-      dx(1) = sx(1) * neu[0] + sy(1) * neu[1] + sz(1) * neu[2];
-      dx(2) = sx(2) * neu[0] + sy(2) * neu[1] + sz(2) * neu[2];
-      dx(3) = sx(3) * neu[0] + sy(3) * neu[1] + sz(3) * neu[2];
+  //dx[0] = sx[0] * neu[0] + sy[0] * neu[1] + sz[0] * neu[2];
+  //dx[1] = sx[1] * neu[0] + sy[1] * neu[1] + sz[1] * neu[2];
+  //dx[2] = sx[2] * neu[0] + sy[2] * neu[1] + sz[2] * neu[2];
 
-      return success;
-    }
-  }
+  dx(1) = sx(1) * neu[0] + sy(1) * neu[1] + sz(1) * neu[2];
+  dx(2) = sx(2) * neu[0] + sy(2) * neu[1] + sz(2) * neu[2];
+  dx(3) = sx(3) * neu[0] + sy(3) * neu[1] + sz(3) * neu[2];
 
-  return failure;
+  return success;
 }
 
-//
+// Receiver Antenna Correction (single lookup)
 ////////////////////////////////////////////////////////////////////////////
 double bncAntex::rcvCorr(const string& antName, t_frequency::type frqType,
                          double eleSat, double azSat, bool& found) const {
 
+  t_pcvHandle handle = rcvHandle(antName, frqType);
+  found = handle.found();
+  return rcvCorr(handle, eleSat, azSat);
+}
+
+// Resolve Receiver Antenna and Frequency
+////////////////////////////////////////////////////////////////////////////
+bncAntex::t_pcvHandle bncAntex::rcvHandle(const string& antName,
+                                          t_frequency::type frqType) const {
+  t_pcvHandle handle;
   if (antName.find("NULLANTENNA") != string::npos) {
-    found = true;
-    return 0.0;
+    handle._nullAntenna = true;
+  }
+  else {
+    handle._frqMap = findFrqMap(QString(antName.c_str()), frqType, &handle._antMap);
   }
+  return handle;
+}
 
-  QString antNameQ = antName.c_str();
+// Receiver Antenna Correction (resolved antenna and frequency)
+////////////////////////////////////////////////////////////////////////////
+double bncAntex::rcvCorr(const t_pcvHandle& handle, double eleSat, double azSat) const {
 
-  if (_maps.find(antNameQ) == _maps.end()) {
-    found = false;
+  const t_frqMap* frqMap = handle._frqMap;
+  if (!frqMap) {
     return 0.0;
   }
 
-  t_antMap* map = _maps[antNameQ];
-  if (map->frqMap.find(frqType) == map->frqMap.end()) {
-    found = false;
+  double var = pcv(handle._antMap, frqMap, 90.0 - eleSat * 180.0 / M_PI,
+                   azSat * 180.0 / M_PI);
+
+  return var - frqMap->neu[0] * cos(azSat)*cos(eleSat)
+             - frqMap->neu[1] * sin(azSat)*cos(eleSat)
+             - frqMap->neu[2] * sin(eleSat);
+}
+
+// Phase Center Variation, bilinear in zenith and azimuth
+////////////////////////////////////////////////////////////////////////////
+double bncAntex::pcv(const t_antMap* map, const t_frqMap* frqMap,
+                     double zenDeg, double azDeg) {
+
+  int nZen = map->nZen;
+  if (nZen <= 0 || frqMap->aziPattern.size() < size_t(nZen)) {
     return 0.0;
   }
 
-  t_frqMap* frqMap = map->frqMap[frqType];
-
-  double var = 0.0;
-  if (frqMap->pattern.Ncols() > 0) {
-    double zenDiff = 999.999;
-    double zenSat  = 90.0 - eleSat * 180.0 / M_PI;
-    unsigned iZen = 0;
-    for (double zen = map->zen1; zen <= map->zen2; zen += map->dZen) {
-      iZen += 1;
-      double newZenDiff = fabs(zen - zenSat);
-      if (newZenDiff < zenDiff) {
-        zenDiff = newZenDiff;
-        var = frqMap->pattern(iZen);
-      }
-    }
+  // Zenith Node and Weight
+  // ----------------------
+  double xx = (zenDeg - map->zen1) / map->dZen;
+  if      (xx < 0.0) {
+    xx = 0.0;
+  }
+  else if (xx > nZen - 1) {
+    xx = nZen - 1;
+  }
+  int    iZen1 = (nZen > 1) ? qMin(int(xx), nZen - 2) : 0;
+  int    iZen2 = (nZen > 1) ? iZen1 + 1               : 0;
+  double wZen  = xx - iZen1;
+
+  // NOAZI Row only
+  // --------------
+  int nAzi = int(frqMap->aziPattern.size()) / nZen;
+  const double* row1 = &frqMap->aziPattern[0];
+  if (nAzi < 2) {
+    return row1[iZen1] + wZen * (row1[iZen2] - row1[iZen1]);
   }
 
-  found = true;
-  return var - frqMap->neu[0] * cos(azSat)*cos(eleSat)
-             - frqMap->neu[1] * sin(azSat)*cos(eleSat)
-             - frqMap->neu[2] * sin(eleSat);
+  // Azimuth Node and Weight (rows from 0 to 360 degrees)
+  // ----------------------------------------------------
+  double az = fmod(azDeg, 360.0);
+  if (az < 0.0) {
+    az += 360.0;
+  }
+  double yy   = az / map->dAzi;
+  int    iAzi = qMin(int(yy), nAzi - 2);
+  double wAzi = yy - iAzi;
+
+  row1 += iAzi * nZen;
+  const double* row2 = row1 + nZen;
+  double val1 = row1[iZen1] + wZen * (row1[iZen2] - row1[iZen1]);
+  double val2 = row2[iZen1] + wZen * (row2[iZen2] - row2[iZen1]);
 
+  return val1 + wAzi * (val2 - val1);
 }
@@ -27,22 +27,49 @@
 
 #include <QtCore>
 #include <string>
+#include <vector>
 #include <newmat/newmat.h>
 #include "bncconst.h"
 #include "bnctime.h"
 
 class bncAntex {
+ private:
+  class t_frqMap;
+  class t_antMap;
+
  public:
+  // Receiver antenna/frequency resolved once, evaluated many times
+  class t_pcvHandle {
+   public:
+    t_pcvHandle() {
+      _antMap      = 0;
+      _frqMap      = 0;
+      _nullAntenna = false;
+    }
+    bool found() const {return _nullAntenna || _frqMap != 0;}
+   private:
+    friend class bncAntex;
+    const t_antMap* _antMap;
+    const t_frqMap* _frqMap;
+    bool            _nullAntenna;
+  };
+
   bncAntex(const char* fileName);
   bncAntex();
   ~bncAntex();
   t_irc   readFile(const QString& fileName);
   void    print() const;
-  QString pcoSinexString(const std::string& antName, t_frequency::type frqType);
+  QString pcoSinexString(const std::string& antName, t_frequency::type frqType) const;
   double  rcvCorr(const std::string& antName, t_frequency::type frqType,
                   double eleSat, double azSat, bool& found) const;
+  t_pcvHandle rcvHandle(const std::string& antName, t_frequency::type frqType) const;
+  double  rcvCorr(const t_pcvHandle& handle, double eleSat, double azSat) const;
   t_irc   satCoMcorrection(const QString& prn, double Mjd,
-                           const NEWMAT::ColumnVector& xSat, NEWMAT::ColumnVector& dx);
+                           const NEWMAT::ColumnVector& xSat, NEWMAT::ColumnVector& dx) const;
+
+  // Process-wide, read-only instance per ANTEX file (null if unreadable).
+  // All query methods are const and safe to call from several threads.
+  static QSharedPointer<const bncAntex> shared(const QString& fileName);
 
  private:
   class t_frqMap {
@@ -53,7 +80,8 @@ class bncAntex {
       }
     }
     double       neu[3];
-    NEWMAT::ColumnVector pattern;
+    NEWMAT::ColumnVector pattern;     // NOAZI values
+    std::vector<double>  aziPattern;  // nAzi rows of nZen values, row-major
   };
 
   class t_antMap {
@@ -62,6 +90,9 @@ class bncAntex {
       zen1 = 0.0;
       zen2 = 0.0;
       dZen = 0.0;
+      dAzi = 0.0;
+      nZen = 0;
+      nAzi = 0;
     }
     ~t_antMap() {
       QMapIterator<t_frequency::type, t_frqMap*> it(frqMap);
@@ -74,12 +105,23 @@ class bncAntex {
     double                             zen1;
     double                             zen2;
     double                             dZen;
+    double                             dAzi;
+    int                                nZen;
+    int                                nAzi;
     QMap<t_frequency::type, t_frqMap*> frqMap;
     bncTime                            validFrom;
     bncTime                            validTo;
   };
 
+  const t_frqMap* findFrqMap(const QString& antName, t_frequency::type frqType,
+                             const t_antMap** antMap = 0) const;
+  static double pcv(const t_antMap* map, const t_frqMap* frqMap,
+                    double zenDeg, double azDeg);
+
   QMap<QString, t_antMap*> _maps;
+
+  static QMutex                                    _sharedMutex;
+  static QMap<QString, QWeakPointer<const bncAntex> > _sharedMaps;
 };
 
 #endif
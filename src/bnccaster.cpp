@@ -43,6 +43,8 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <string.h>
+#include <QtEndian>
 
 #include "bnccaster.h"
 #include "bncrinex.h"
@@ -66,6 +68,12 @@ bncCaster::bncCaster() {
   _out     = 0;
   reopenOutFile();
 
+  _maxQueueBytes = 1024 * settings.value("outQueueSize").toLongLong();
+  if (_maxQueueBytes <= 0) {
+    _maxQueueBytes = 1024 * 1024;
+  }
+  _overflow = bncCasterClient::overflowPolicy(settings.value("outQueueOverflow").toString());
+
   int port = settings.value("outPort").toInt();
 
   if (port != 0) {
@@ -74,7 +82,7 @@ bncCaster::bncCaster() {
       emit newMessage("bncCaster: Cannot listen on sync port", true);
     }
     connect(_server, SIGNAL(newConnection()), this, SLOT(slotNewConnection()));
-    _sockets = new QList<QTcpSocket*>;
+    _sockets = new QList<bncCasterClient*>;
   }
   else {
     _server  = 0;
@@ -88,7 +96,7 @@ bncCaster::bncCaster() {
       emit newMessage("bncCaster: Cannot listen on usync port", true);
     }
     connect(_uServer, SIGNAL(newConnection()), this, SLOT(slotNewUConnection()));
-    _uSockets = new QList<QTcpSocket*>;
+    _uSockets = new QList<bncCasterClient*>;
   }
   else {
     _uServer  = 0;
@@ -100,7 +108,10 @@ bncCaster::bncCaster() {
   if (_outWait <= 0.0) {
     _outWait = 0.01;
   }
+  _dumpPending  = false;
   _confInterval = -1;
+  _binary       = (settings.value("outFormat").toString()  == "binary");
+  _uBinary      = (settings.value("outUFormat").toString() == "binary");
 
   // Miscellaneous output port
   // -------------------------
@@ -112,7 +123,7 @@ bncCaster::bncCaster() {
       emit newMessage("bncCaster: Cannot listen on Miscellaneous Output Port", true);
     }
     connect(_miscServer, SIGNAL(newConnection()), this, SLOT(slotNewMiscConnection()));
-    _miscSockets = new QList<QTcpSocket*>;
+    _miscSockets = new QList<bncCasterClient*>;
   }
   else {
     _miscServer  = 0;
@@ -136,6 +147,9 @@ bncCaster::~bncCaster() {
   }
   delete _out;
   delete _outFile;
+  if (_sockets)     qDeleteAll(*_sockets);
+  if (_uSockets)    qDeleteAll(*_uSockets);
+  if (_miscSockets) qDeleteAll(*_miscSockets);
   delete _server;
   delete _sockets;
   delete _uServer;
@@ -144,114 +158,181 @@ bncCaster::~bncCaster() {
   delete _miscSockets;
 }
 
-// New Observations
+// New Observations, output into the unsynchronized port
 ////////////////////////////////////////////////////////////////////////////
-void bncCaster::slotNewObs(const QByteArray staID, QList<t_satObs> obsList) {
-
-  QMutexLocker locker(&_mutex);
-
-  reopenOutFile();
-
-  unsigned index = 0;
-  QMutableListIterator<t_satObs> it(obsList);
-  while (it.hasNext()) {
-    ++index;
-    t_satObs& obs = it.next();
-
-    // Rename the Station
-    // ------------------
-    obs._staID = staID.data();
-
-    // Output into the socket
-    // ----------------------
-    if (_uSockets) {
+void bncCaster::slotNewObs(t_satObsBatchPtr obsBatch) {
+
+  // Binary records, one per epoch of the batch
+  // -------------------------------------------
+  if (_uSockets && _uBinary) {
+    const QList<t_satObs>& obsList = obsBatch->_obsList;
+    QByteArray               buf;
+    QVector<const t_satObs*> epoObs;
+    for (int ii = 0; ii < obsList.size(); ii++) {
+      if (!epoObs.isEmpty() && epoObs.last()->_time != obsList[ii]._time) {
+        binaryEpoch(buf, epoObs);
+        epoObs.clear();
+      }
+      epoObs.append(&obsList[ii]);
+    }
+    binaryEpoch(buf, epoObs);
+    sendToClients(_uSockets, buf);
+  }
 
-      ostringstream oStr;
-      oStr.setf(ios::showpoint | ios::fixed);
+  // Whole batch formatted once
+  // --------------------------
+  else if (_uSockets) {
+    const QList<t_satObs>& obsList = obsBatch->_obsList;
+    ostringstream oStr;
+    oStr.setf(ios::showpoint | ios::fixed);
+    for (int ii = 0; ii < obsList.size(); ii++) {
+      const t_satObs& obs = obsList[ii];
       oStr << obs._staID                                        << " "
            << setw(4)  << obs._time.gpsw()                      << " "
-           << setw(14) << setprecision(7) << obs._time.gpssec() << " "
-           << bncRinex::asciiSatLine(obs) << endl;
+           << setw(14) << setprecision(7) << obs._time.gpssec() << " ";
+      bncRinex::asciiSatLine(oStr, obs);
+      oStr << '\n';
+    }
+    string hlpStr = oStr.str();
+    sendToClients(_uSockets, QByteArray(hlpStr.c_str(), hlpStr.length()));
+  }
+}
 
-      string hlpStr = oStr.str();
+// New Observations into the epoch slots (called in the get threads)
+////////////////////////////////////////////////////////////////////////////
+void bncCaster::slotAddObs(t_satObsBatchPtr obsBatch) {
+
+  const QByteArray&      staID   = obsBatch->_staID;
+  const QList<t_satObs>& obsList = obsBatch->_obsList;
+  bool                   newDump = false;
+
+  // A batch normally carries one epoch, the dump state is checked once
+  // per epoch, not per observation
+  // ------------------------------------------------------------------
+  int iBeg = 0;
+  while (iBeg < obsList.size()) {
+    const bncTime& epoTime = obsList[iBeg]._time;
+    int iEnd = iBeg + 1;
+    while (iEnd < obsList.size() && obsList[iEnd]._time == epoTime) {
+      ++iEnd;
+    }
+    t_epochSlot& slot = _epochSlots[epochSlot(epoTime)];
+
+    // The slot stays locked until the observations are saved, a dump
+    // started meanwhile either sees them or has already moved
+    // _lastDumpTime beyond them
+    // --------------------------------------------------------------
+    QMutexLocker slotLocker(&slot._mutex);
+
+    bool oldObs = false;
+    {
+      QMutexLocker dumpLocker(&_dumpMutex);
+
+      // First time: set the _lastDumpTime
+      // ---------------------------------
+      if (!_lastDumpTime.valid()) {
+        _lastDumpTime = epoTime - 1.0;
+      }
+
+      oldObs = (epoTime <= _lastDumpTime);
 
-      QMutableListIterator<QTcpSocket*> is(*_uSockets);
-      while (is.hasNext()) {
-        QTcpSocket* sock = is.next();
-        if (sock->state() == QAbstractSocket::ConnectedState) {
-          int numBytes = hlpStr.length();
-          if (myWrite(sock, hlpStr.c_str(), numBytes) != numBytes) {
-            delete sock;
-            is.remove();
-          }
+      // Request a dump of the complete epochs
+      // -------------------------------------
+      if (!oldObs && epoTime - _outWait > _lastDumpTime) {
+        if (!_dumpPending) {
+          _dumpPending = true;
+          _dumpUntil   = epoTime - _outWait;
+          newDump      = true;
         }
-        else if (sock->state() != QAbstractSocket::ConnectingState) {
-          delete sock;
-          is.remove();
+        else if (epoTime - _outWait > _dumpUntil) {
+          _dumpUntil   = epoTime - _outWait;
         }
       }
     }
 
-    // First time: set the _lastDumpTime
-    // ---------------------------------
-    if (!_lastDumpTime.valid()) {
-      _lastDumpTime = obs._time - 1.0;
-    }
-
-    // An old observation - throw it away
-    // ----------------------------------
-    if (obs._time <= _lastDumpTime) {
-      if (index == 1) {
+    // An old epoch - throw it away
+    // ----------------------------
+    if (oldObs) {
+      if (iBeg == 0) {
         bncSettings settings;
         if ( !settings.value("outFile").toString().isEmpty() ||
              !settings.value("outPort").toString().isEmpty() ) {
           emit( newMessage(QString("%1: Old epoch %2 thrown away")
-          		   .arg(staID.data()).arg(string(obs._time).c_str())
+          		   .arg(staID.data()).arg(string(epoTime).c_str())
                    .toLatin1(), true) );
         }
       }
-      continue;
     }
 
-    // Save the observation
-    // --------------------
-    _epochs[obs._time].append(obs);
-
-    // Dump Epochs
-    // -----------
-    if (obs._time - _outWait > _lastDumpTime) {
-      dumpEpochs(obs._time - _outWait);
-      _lastDumpTime = obs._time - _outWait;
+    // Save the observations
+    // ---------------------
+    else {
+      QVector<t_obsRef>& epoObs = slot._epochs[epoTime];
+      for (int ii = iBeg; ii < iEnd; ii++) {
+        epoObs.append(t_obsRef(obsBatch, ii));
+      }
     }
+
+    iBeg = iEnd;
+  }
+
+  // Dump Epochs (in the thread of the caster)
+  // -----------------------------------------
+  if (newDump) {
+    QMetaObject::invokeMethod(this, "slotDumpEpochs", Qt::QueuedConnection);
   }
 }
 
 // New Connection
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::slotNewConnection() {
-  _sockets->push_back( _server->nextPendingConnection() );
+  _sockets->push_back( newClient(_server, "sync port") );
   emit( newMessage(QString("New client connection on sync port: # %1")
                    .arg(_sockets->size()).toLatin1(), true) );
 }
 
 void bncCaster::slotNewUConnection() {
-  _uSockets->push_back( _uServer->nextPendingConnection() );
+  _uSockets->push_back( newClient(_uServer, "usync port") );
   emit( newMessage(QString("New client connection on usync port: # %1")
                    .arg(_uSockets->size()).toLatin1(), true) );
 }
 
+// Create the (queued) client of a new connection
+////////////////////////////////////////////////////////////////////////////
+bncCasterClient* bncCaster::newClient(QTcpServer* server, const QString& portName) {
+  return new bncCasterClient(server->nextPendingConnection(), portName,
+                             _maxQueueBytes, _overflow);
+}
+
+// Queue data for all clients of a port, remove closed clients
+////////////////////////////////////////////////////////////////////////////
+void bncCaster::sendToClients(QList<bncCasterClient*>* clients, const QByteArray& data) {
+  QMutableListIterator<bncCasterClient*> is(*clients);
+  while (is.hasNext()) {
+    bncCasterClient* client = is.next();
+    client->send(data);
+    if (client->closed()) {
+      delete client;
+      is.remove();
+    }
+  }
+}
+
 // Add New Thread
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::addGetThread(bncGetThread* getThread, bool noNewThread) {
 
   qRegisterMetaType<t_satObs>("t_satObs");
-  qRegisterMetaType< QList<t_satObs> >("QList<t_satObs>");
+  qRegisterMetaType<t_satObsBatchPtr>("t_satObsBatchPtr");
+
+  connect(getThread, SIGNAL(newObs(t_satObsBatchPtr)),
+          this,      SLOT(slotNewObs(t_satObsBatchPtr)));
 
-  connect(getThread, SIGNAL(newObs(QByteArray, QList<t_satObs>)),
-          this,      SLOT(slotNewObs(QByteArray, QList<t_satObs>)));
+  connect(getThread, SIGNAL(newObs(t_satObsBatchPtr)),
+          this,      SLOT(slotAddObs(t_satObsBatchPtr)), Qt::DirectConnection);
 
-  connect(getThread, SIGNAL(newObs(QByteArray, QList<t_satObs>)),
-          this,      SIGNAL(newObs(QByteArray, QList<t_satObs>)));
+  connect(getThread, SIGNAL(newObs(t_satObsBatchPtr)),
+          this,      SIGNAL(newObs(t_satObsBatchPtr)));
 
   connect(getThread, SIGNAL(newRawData(QByteArray, QByteArray)),
           this,      SLOT(slotNewRawData(QByteArray, QByteArray)));
@@ -292,70 +373,213 @@ void bncCaster::slotGetThreadFinished(QByteArray staID) {
   }
 }
 
+// Take the complete epochs out of the slots (private slot)
+////////////////////////////////////////////////////////////////////////////
+void bncCaster::slotDumpEpochs() {
+
+  QMutexLocker locker(&_mutex);
+
+  // Observations up to maxTime arriving from now on are thrown away
+  // ---------------------------------------------------------------
+  bncTime maxTime;
+  {
+    QMutexLocker dumpLocker(&_dumpMutex);
+    if (!_dumpPending) {
+      return;
+    }
+    maxTime       = _dumpUntil;
+    _lastDumpTime = maxTime;
+    _dumpPending  = false;
+  }
+
+  QMap<bncTime, QVector<t_obsRef> > epochs;
+  for (int iSlot = 0; iSlot < NUMEPOCHSLOTS; iSlot++) {
+    t_epochSlot& slot = _epochSlots[iSlot];
+    QMutexLocker slotLocker(&slot._mutex);
+    QMap<bncTime, QVector<t_obsRef> >::iterator itEpo = slot._epochs.begin();
+    while (itEpo != slot._epochs.end() && itEpo.key() <= maxTime) {
+      epochs.insert(itEpo.key(), itEpo.value());
+      itEpo = slot._epochs.erase(itEpo);
+    }
+  }
+
+  reopenOutFile();
+  dumpEpochs(epochs);
+}
+
 // Dump Complete Epochs
 ////////////////////////////////////////////////////////////////////////////
-void bncCaster::dumpEpochs(const bncTime& maxTime) {
+void bncCaster::dumpEpochs(const QMap<bncTime, QVector<t_obsRef> >& epochs) {
+
+  if (!_out && !_sockets) {
+    return;
+  }
 
-  QMutableMapIterator<bncTime, QList<t_satObs> > itEpo(_epochs);
+  QMapIterator<bncTime, QVector<t_obsRef> > itEpo(epochs);
   while (itEpo.hasNext()) {
     itEpo.next();
-    const bncTime& epoTime = itEpo.key();
-    if (epoTime <= maxTime) {
-      const QList<t_satObs>& allObs = itEpo.value();
-      int sec = int(nint(epoTime.gpssec()));
-      if ( (_out || _sockets) && (_samplingRate == 0 || sec % _samplingRate == 0) ) {
-
-        QListIterator<t_satObs> it(allObs);
-        bool firstObs = true;
-        while (it.hasNext()) {
-          const t_satObs& obs = it.next();
-
-          ostringstream oStr;
-          oStr.setf(ios::showpoint | ios::fixed);
-          if (firstObs) {
-            firstObs = false;
-            oStr << "> " << obs._time.gpsw() << ' '
-                 << setprecision(7) << obs._time.gpssec() << endl;
-          }
-          oStr << obs._staID << ' ' << bncRinex::asciiSatLine(obs) << endl;
-          if (!it.hasNext()) {
-            oStr << endl;
-          }
-          string hlpStr = oStr.str();
-
-          // Output into the File
-          // --------------------
-          if (_out) {
-            *_out << hlpStr.c_str();
-            _out->flush();
-          }
-
-          // Output into the socket
-          // ----------------------
-          if (_sockets) {
-            QMutableListIterator<QTcpSocket*> is(*_sockets);
-            while (is.hasNext()) {
-              QTcpSocket* sock = is.next();
-              if (sock->state() == QAbstractSocket::ConnectedState) {
-                int numBytes = hlpStr.length();
-                if (myWrite(sock, hlpStr.c_str(), numBytes) != numBytes) {
-                  delete sock;
-                  is.remove();
-                }
-              }
-              else if (sock->state() != QAbstractSocket::ConnectingState) {
-                delete sock;
-                is.remove();
-              }
-            }
-          }
+    const bncTime&           epoTime = itEpo.key();
+    const QVector<t_obsRef>& allObs  = itEpo.value();
+    int sec = int(nint(epoTime.gpssec()));
+    if (_samplingRate != 0 && sec % _samplingRate != 0) {
+      continue;
+    }
+
+    // Format the whole epoch once
+    // ---------------------------
+    QByteArray epoBuf;
+    if (_out || !_binary) {
+      ostringstream oStr;
+      oStr.setf(ios::showpoint | ios::fixed);
+      QVectorIterator<t_obsRef> it(allObs);
+      bool firstObs = true;
+      while (it.hasNext()) {
+        const t_satObs& obs = it.next().obs();
+        if (firstObs) {
+          firstObs = false;
+          oStr << "> " << obs._time.gpsw() << ' '
+               << setprecision(7) << obs._time.gpssec() << '\n';
         }
+        oStr << obs._staID << ' ';
+        bncRinex::asciiSatLine(oStr, obs);
+        oStr << '\n';
+      }
+      oStr << '\n';
+      string hlpStr = oStr.str();
+      epoBuf = QByteArray(hlpStr.c_str(), hlpStr.length());
+    }
+
+    // Output into the File
+    // --------------------
+    if (_out) {
+      *_out << epoBuf;
+      _out->flush();
+    }
+
+    // Output into the sockets (one shared buffer)
+    // -------------------------------------------
+    if (_sockets) {
+      if (_binary) {
+        QVector<const t_satObs*> epoObs(allObs.size());
+        for (int ii = 0; ii < allObs.size(); ii++) {
+          epoObs[ii] = &allObs[ii].obs();
+        }
+        QByteArray binBuf;
+        binaryEpoch(binBuf, epoObs);
+        sendToClients(_sockets, binBuf);
+      }
+      else {
+        sendToClients(_sockets, epoBuf);
       }
-      _epochs.remove(epoTime);
     }
   }
 }
 
+// Binary output format of the observation ports (little endian)
+//
+//   record:  "BNCO" length(uint32, bytes following)
+//            gpsWeek(int32) gpsSec(float64) nStations(uint16)
+//   station: idLength(uint8) id nSat(uint16)
+//   sat:     system(char) number(uint8) nSig(uint8)
+//   signal:  code(2 chars) flags(uint8) [slipCounter(int16)]
+//            [code] [phase] [doppler] [snr] (float64 each)
+//
+// flags: 1 code, 2 phase (with slipCounter), 4 doppler, 8 snr, 16 slip.
+// One record per epoch, consecutive observations of the same station form
+// one station block.
+////////////////////////////////////////////////////////////////////////////
+static void putUInt8(QByteArray& buf, quint8 val) {
+  buf.append(char(val));
+}
+
+static void putInt16(QByteArray& buf, qint16 val) {
+  char hlp[2];
+  qToLittleEndian<qint16>(val, reinterpret_cast<uchar*>(hlp));
+  buf.append(hlp, 2);
+}
+
+static void putInt32(QByteArray& buf, qint32 val) {
+  char hlp[4];
+  qToLittleEndian<qint32>(val, reinterpret_cast<uchar*>(hlp));
+  buf.append(hlp, 4);
+}
+
+static void putDouble(QByteArray& buf, double val) {
+  quint64 hlp;
+  memcpy(&hlp, &val, 8);
+  char bytes[8];
+  qToLittleEndian<quint64>(hlp, reinterpret_cast<uchar*>(bytes));
+  buf.append(bytes, 8);
+}
+
+static void setUInt16(QByteArray& buf, int pos, quint16 val) {
+  qToLittleEndian<quint16>(val, reinterpret_cast<uchar*>(buf.data() + pos));
+}
+
+// Append one epoch as binary record
+////////////////////////////////////////////////////////////////////////////
+void bncCaster::binaryEpoch(QByteArray& buf, const QVector<const t_satObs*>& obsList) {
+
+  if (obsList.isEmpty()) {
+    return;
+  }
+
+  int recStart = buf.size();
+  buf.append("BNCO", 4);
+  putInt32(buf, 0);                     // length, set at the end
+  putInt32(buf, obsList[0]->_time.gpsw());
+  putDouble(buf, obsList[0]->_time.gpssec());
+  int nStaPos = buf.size();
+  putInt16(buf, 0);
+
+  int  nSta    = 0;
+  int  nSatPos = 0;
+  int  nSat    = 0;
+  for (int ii = 0; ii < obsList.size(); ii++) {
+    const t_satObs& obs = *obsList[ii];
+
+    // New station block
+    // -----------------
+    if (ii == 0 || obs._staID != obsList[ii-1]->_staID) {
+      if (nSta > 0) {
+        setUInt16(buf, nSatPos, nSat);
+      }
+      ++nSta;
+      nSat = 0;
+      int idLen = qMin(int(obs._staID.length()), 255);
+      putUInt8(buf, idLen);
+      buf.append(obs._staID.data(), idLen);
+      nSatPos = buf.size();
+      putInt16(buf, 0);
+    }
+    ++nSat;
+
+    putUInt8(buf, obs._prn.system());
+    putUInt8(buf, obs._prn.number());
+    putUInt8(buf, obs._obs.size());
+    for (unsigned iFrq = 0; iFrq < obs._obs.size(); iFrq++) {
+      const t_frqObs& frqObs = obs._obs[iFrq];
+      quint8 flags = (frqObs._codeValid    ?  1 : 0) |
+                     (frqObs._phaseValid   ?  2 : 0) |
+                     (frqObs._dopplerValid ?  4 : 0) |
+                     (frqObs._snrValid     ?  8 : 0) |
+                     (frqObs._slip         ? 16 : 0);
+      putUInt8(buf, frqObs._rnxType2ch[0]);
+      putUInt8(buf, frqObs._rnxType2ch[1]);
+      putUInt8(buf, flags);
+      if (frqObs._phaseValid)   putInt16 (buf, frqObs._slipCounter);
+      if (frqObs._codeValid)    putDouble(buf, frqObs._code);
+      if (frqObs._phaseValid)   putDouble(buf, frqObs._phase);
+      if (frqObs._dopplerValid) putDouble(buf, frqObs._doppler);
+      if (frqObs._snrValid)     putDouble(buf, frqObs._snr);
+    }
+  }
+  setUInt16(buf, nSatPos, nSat);
+  setUInt16(buf, nStaPos, nSta);
+  qToLittleEndian<quint32>(buf.size() - recStart - 8,
+                           reinterpret_cast<uchar*>(buf.data() + recStart + 4));
+}
+
 // Reread configuration (private slot)
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::slotReadMountPoints() {
@@ -374,10 +598,13 @@ void bncCaster::readMountPoints() {
 
   // Reread several options
   // ----------------------
-  _samplingRate = settings.value("outSampl").toInt();
-  _outWait      = settings.value("outWait").toInt();
-  if (_outWait < 1) {
-    _outWait = 1;
+  {
+    QMutexLocker dumpLocker(&_dumpMutex);
+    _samplingRate = settings.value("outSampl").toInt();
+    _outWait      = settings.value("outWait").toInt();
+    if (_outWait < 1) {
+      _outWait = 1;
+    }
   }
 
   // Add new mountpoints
@@ -488,18 +715,6 @@ void bncCaster::readMountPoints() {
   QTimer::singleShot(ms, this, SLOT(slotReadMountPoints()));
 }
 
-//
-////////////////////////////////////////////////////////////////////////////
-int bncCaster::myWrite(QTcpSocket* sock, const char* buf, int bufLen) {
-  sock->write(buf, bufLen);
-  for (int ii = 1; ii <= 10; ii++) {
-    if (sock->waitForBytesWritten(10)) {  // wait 10 ms
-      return bufLen;
-    }
-  }
-  return -1;
-}
-
 //
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::reopenOutFile() {
@@ -533,24 +748,14 @@ void bncCaster::reopenOutFile() {
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::slotNewRawData(QByteArray staID, QByteArray data) {
   if (_miscSockets && (_miscMount == "ALL" || _miscMount == staID)) {
-    QMutableListIterator<QTcpSocket*> is(*_miscSockets);
-    while (is.hasNext()) {
-      QTcpSocket* sock = is.next();
-      if (sock->state() == QAbstractSocket::ConnectedState) {
-        sock->write(data);
-      }
-      else if (sock->state() != QAbstractSocket::ConnectingState) {
-        delete sock;
-        is.remove();
-      }
-    }
+    sendToClients(_miscSockets, data);
   }
 }
 
 // New Connection
 ////////////////////////////////////////////////////////////////////////////
 void bncCaster::slotNewMiscConnection() {
-  _miscSockets->push_back( _miscServer->nextPendingConnection() );
+  _miscSockets->push_back( newClient(_miscServer, "Miscellaneous Output Port") );
   emit( newMessage(QString("New client connection on Miscellaneous Output Port: # %1")
                    .arg(_miscSockets->size()).toLatin1(), true) );
 }
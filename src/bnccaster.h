@@ -25,10 +25,12 @@
 #ifndef BNCCASTER_H
 #define BNCCASTER_H
 
+#include <math.h>
 #include <QFile>
 #include <QtNetwork>
 #include <QMultiMap>
 #include "satObs.h"
+#include "bnccasterclient.h"
 
 class bncGetThread;
 
@@ -43,7 +45,8 @@ class bncCaster : public QObject {
    void readMountPoints();
 
  public slots:
-   void slotNewObs(QByteArray staID, QList<t_satObs> obsList);
+   void slotNewObs(t_satObsBatchPtr obsBatch);
+   void slotAddObs(t_satObsBatchPtr obsBatch);
    void slotNewRawData(QByteArray staID, QByteArray data);
    void slotNewMiscConnection();
 
@@ -51,37 +54,72 @@ class bncCaster : public QObject {
    void mountPointsRead(QList<bncGetThread*>);
    void getThreadsFinished();   
    void newMessage(QByteArray msg, bool showOnScreen);
-   void newObs(QByteArray staID, QList<t_satObs> obsList);
+   void newObs(t_satObsBatchPtr obsBatch);
 
    private slots:
    void slotReadMountPoints();
    void slotNewConnection();
    void slotNewUConnection();
    void slotGetThreadFinished(QByteArray staID);
+   void slotDumpEpochs();
 
  private:
-   void dumpEpochs(const bncTime& maxTime);
-   static int myWrite(QTcpSocket* sock, const char* buf, int bufLen);
+   // Observation inside a shared batch
+   class t_obsRef {
+    public:
+     t_obsRef() {_index = 0;}
+     t_obsRef(const t_satObsBatchPtr& batch, int index) {
+       _batch = batch;
+       _index = index;
+     }
+     const t_satObs& obs() const {return _batch->_obsList[_index];}
+     t_satObsBatchPtr _batch;
+     int              _index;
+   };
+
+   // Epochs of one second modulo NUMEPOCHSLOTS, the slots are filled by
+   // the get threads without a common lock
+   static const int NUMEPOCHSLOTS = 64;
+   class t_epochSlot {
+    public:
+     QMutex                            _mutex;
+     QMap<bncTime, QVector<t_obsRef> > _epochs;
+   };
+   static int epochSlot(const bncTime& epoTime) {
+     return int(long(floor(epoTime.gpssec())) % NUMEPOCHSLOTS);
+   }
+
+   void dumpEpochs(const QMap<bncTime, QVector<t_obsRef> >& epochs);
+   static void binaryEpoch(QByteArray& buf, const QVector<const t_satObs*>& obsList);
+   void sendToClients(QList<bncCasterClient*>* clients, const QByteArray& data);
+   bncCasterClient* newClient(QTcpServer* server, const QString& portName);
    void reopenOutFile();
 
    QFile*                          _outFile;
    QTextStream*                    _out;
-   QMap<bncTime, QList<t_satObs> > _epochs;
+   t_epochSlot                     _epochSlots[NUMEPOCHSLOTS];
+   QMutex                          _dumpMutex;
    bncTime                         _lastDumpTime;
+   bncTime                         _dumpUntil;
+   bool                            _dumpPending;
    QTcpServer*                     _server;
    QTcpServer*                     _uServer;
-   QList<QTcpSocket*>*             _sockets;
-   QList<QTcpSocket*>*             _uSockets;
+   QList<bncCasterClient*>*        _sockets;
+   QList<bncCasterClient*>*        _uSockets;
    QList<QByteArray>               _staIDs;
    QList<bncGetThread*>            _threads;
    int                             _samplingRate;
+   bool                            _binary;
+   bool                            _uBinary;
    double                          _outWait;
    QMutex                          _mutex;
    int                             _confInterval;
    QString                         _miscMount;
    int                             _miscPort;
    QTcpServer*                     _miscServer;
-   QList<QTcpSocket*>*             _miscSockets;
+   QList<bncCasterClient*>*        _miscSockets;
+   qint64                          _maxQueueBytes;
+   bncCasterClient::e_overflow     _overflow;
 };
 
 #endif
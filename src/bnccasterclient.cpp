@@ -0,0 +1,194 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      bncCasterClient
+ *
+ * Purpose:    Bounded, non-blocking output queue of an output port client
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include "bnccasterclient.h"
+#include "bnccore.h"
+
+// Data handed to the socket at once (the rest stays in the queue)
+////////////////////////////////////////////////////////////////////////////
+static const qint64 SOCKET_BUFFER = 64 * 1024;
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+bncCasterClient::bncCasterClient(QTcpSocket* socket, const QString& portName,
+                                 qint64 maxQueueBytes, e_overflow overflow) {
+  _socket        = socket;
+  _name          = QString("Client %1:%2 on %3")
+                   .arg(socket->peerAddress().toString())
+                   .arg(socket->peerPort()).arg(portName);
+  _maxQueueBytes = maxQueueBytes;
+  _overflow      = overflow;
+  _queueBytes    = 0;
+  _bytesSent     = 0;
+  _bytesDropped  = 0;
+  _nDropped      = 0;
+  _maxLag        = 0.0;
+  _closed        = false;
+  _clock.start();
+
+  connect(this, SIGNAL(newMessage(QByteArray,bool)),
+          BNC_CORE, SLOT(slotMessage(const QByteArray,bool)));
+  connect(_socket, SIGNAL(bytesWritten(qint64)), this, SLOT(slotBytesWritten(qint64)));
+  connect(_socket, SIGNAL(disconnected()), this, SLOT(slotDisconnected()));
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+bncCasterClient::~bncCasterClient() {
+  _socket->disconnect(this);
+  _socket->abort();
+  _socket->deleteLater();
+}
+
+// Overflow policy from its settings value
+////////////////////////////////////////////////////////////////////////////
+bncCasterClient::e_overflow bncCasterClient::overflowPolicy(const QString& str) {
+  if (str == "disconnect") {
+    return disconnectClient;
+  }
+  return dropOldest;
+}
+
+// Queue data, never blocks
+////////////////////////////////////////////////////////////////////////////
+void bncCasterClient::send(const QByteArray& data) {
+
+  if (_closed) {
+    return;
+  }
+  if      (_socket->state() == QAbstractSocket::ConnectingState) {
+    return;
+  }
+  else if (_socket->state() != QAbstractSocket::ConnectedState) {
+    close("not connected");
+    return;
+  }
+
+  t_queueEntry entry;
+  entry._data = data;
+  entry._msec = _clock.elapsed();
+  _queue.enqueue(entry);
+  _queueBytes += data.size();
+
+  // Queue overflow
+  // --------------
+  while (_queueBytes > _maxQueueBytes && !_queue.isEmpty()) {
+    if (_overflow == disconnectClient) {
+      close("output queue overflow");
+      return;
+    }
+    if (_nDropped == 0) {
+      emit newMessage(QString("%1: output queue overflow, dropping oldest data")
+                      .arg(_name).toLatin1(), true);
+    }
+    _queueBytes   -= _queue.head()._data.size();
+    _bytesDropped += _queue.head()._data.size();
+    ++_nDropped;
+    _queue.dequeue();
+  }
+
+  flushQueue();
+}
+
+// Hand over queued data as far as the socket buffer allows
+////////////////////////////////////////////////////////////////////////////
+void bncCasterClient::flushQueue() {
+  while (!_queue.isEmpty() && _socket->bytesToWrite() < SOCKET_BUFFER) {
+    t_queueEntry entry = _queue.dequeue();
+    _queueBytes -= entry._data.size();
+    double lag = (_clock.elapsed() - entry._msec) / 1000.0;
+    if (lag > _maxLag) {
+      _maxLag = lag;
+    }
+    _socket->write(entry._data);
+    _bytesSent += entry._data.size();
+  }
+  _socket->flush();
+}
+
+// 
+////////////////////////////////////////////////////////////////////////////
+void bncCasterClient::slotBytesWritten(qint64 /* nBytes */) {
+  if (!_closed) {
+    flushQueue();
+  }
+}
+
+// 
+////////////////////////////////////////////////////////////////////////////
+void bncCasterClient::slotDisconnected() {
+  close("disconnected");
+}
+
+// Close the connection, the owner deletes closed clients
+////////////////////////////////////////////////////////////////////////////
+void bncCasterClient::close(const QString& reason) {
+  if (_closed) {
+    return;
+  }
+  _closed = true;
+  _queue.clear();
+  _queueBytes = 0;
+  _socket->abort();
+  emit newMessage(QString("%1 %2").arg(statistics()).arg(reason).toLatin1(), true);
+}
+
+// Bytes waiting in the queue and in the socket buffer
+////////////////////////////////////////////////////////////////////////////
+qint64 bncCasterClient::queuedBytes() const {
+  return _queueBytes + (_closed ? 0 : _socket->bytesToWrite());
+}
+
+// Age of the oldest queued data in seconds
+////////////////////////////////////////////////////////////////////////////
+double bncCasterClient::lag() const {
+  if (_queue.isEmpty()) {
+    return 0.0;
+  }
+  return (_clock.elapsed() - _queue.head()._msec) / 1000.0;
+}
+
+// 
+////////////////////////////////////////////////////////////////////////////
+QString bncCasterClient::statistics() const {
+  return QString("%1: %2 bytes sent, %3 bytes queued, lag %4 s (max. %5 s), "
+                 "%6 blocks (%7 bytes) dropped")
+         .arg(_name).arg(_bytesSent).arg(queuedBytes())
+         .arg(lag(), 0, 'f', 1).arg(_maxLag, 0, 'f', 1)
+         .arg(_nDropped).arg(_bytesDropped);
+}
@@ -0,0 +1,85 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+#ifndef BNCCASTERCLIENT_H
+#define BNCCASTERCLIENT_H
+
+#include <QTcpSocket>
+#include <QQueue>
+#include <QElapsedTimer>
+
+// Client of one of the output ports of bncCaster. Data are queued per
+// client and written without blocking, a slow client cannot delay the
+// other clients or the decoding.
+////////////////////////////////////////////////////////////////////////////
+class bncCasterClient : public QObject {
+ Q_OBJECT
+
+ public:
+  enum e_overflow {dropOldest, disconnectClient};
+
+  bncCasterClient(QTcpSocket* socket, const QString& portName,
+                  qint64 maxQueueBytes, e_overflow overflow);
+  ~bncCasterClient();
+
+  void    send(const QByteArray& data);
+  bool    closed() const {return _closed;}
+  qint64  queuedBytes() const;
+  double  lag() const;
+  QString statistics() const;
+
+  static e_overflow overflowPolicy(const QString& str);
+
+ signals:
+  void newMessage(QByteArray msg, bool showOnScreen);
+
+ private slots:
+  void slotBytesWritten(qint64 nBytes);
+  void slotDisconnected();
+
+ private:
+  class t_queueEntry {
+   public:
+    QByteArray _data;
+    qint64     _msec;   // time of queuing
+  };
+
+  void flushQueue();
+  void close(const QString& reason);
+
+  QTcpSocket*           _socket;
+  QString               _name;
+  qint64                _maxQueueBytes;
+  e_overflow            _overflow;
+  QQueue<t_queueEntry>  _queue;
+  qint64                _queueBytes;
+  QElapsedTimer         _clock;
+  qint64                _bytesSent;
+  qint64                _bytesDropped;
+  long                  _nDropped;
+  double                _maxLag;
+  bool                  _closed;
+};
+
+#endif
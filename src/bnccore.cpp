@@ -104,6 +104,7 @@ t_bncCore::t_bncCore() : _ephUser(false) {
 
   _userName       = _userName.leftJustified(20, ' ', true);
   _dateAndTimeGPS = 0;
+  _dateAndTimeGPSSet.storeRelease(0);
   _mainWindow     = 0;
 
   _pppMain = new BNC_PPP::t_pppMain();
@@ -744,13 +745,7 @@ void t_bncCore::stopCombination() {
 //
 ////////////////////////////////////////////////////////////////////////////
 bool t_bncCore::dateAndTimeGPSSet() const {
-  QMutexLocker locker(&_mutexDateAndTimeGPS);
-  if (_dateAndTimeGPS) {
-    return true;
-  }
-  else {
-    return false;
-  }
+  return _dateAndTimeGPSSet.loadAcquire() != 0;
 }
 
 //
@@ -771,6 +766,7 @@ void t_bncCore::setDateAndTimeGPS(QDateTime dateTime) {
   QMutexLocker locker(&_mutexDateAndTimeGPS);
   delete _dateAndTimeGPS;
   _dateAndTimeGPS = new QDateTime(dateTime);
+  _dateAndTimeGPSSet.storeRelease(1);
 }
 
 //
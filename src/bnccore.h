@@ -154,6 +154,7 @@ friend class bncSettings;
   QWidget*               _mainWindow;
   bool                   _GUIenabled;
   QDateTime*             _dateAndTimeGPS;
+  QAtomicInt             _dateAndTimeGPSSet;
   mutable QMutex         _mutexDateAndTimeGPS;
   BNC_PPP::t_pppMain*    _pppMain;
   bncEphUser             _ephUser;
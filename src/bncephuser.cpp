@@ -24,6 +24,7 @@
 
 
 #include <iostream>
+#include <cstring>
 
 #include "bncephuser.h"
 #include "bnccore.h"
@@ -51,19 +52,88 @@ bncEphUser::bncEphUser(bool connectSlots) {
     connect(BNC_CORE, SIGNAL(newBDSEph(t_ephBDS)),
             this, SLOT(slotNewBDSEph(t_ephBDS)), Qt::DirectConnection);
   }
+  _clock.start();
 }
 
 // Destructor
 ////////////////////////////////////////////////////////////////////////////
 bncEphUser::~bncEphUser() {
-  QMapIterator<QString, deque<t_eph*> > it(_eph);
-  while (it.hasNext()) {
-    it.next();
-    const deque<t_eph*>& qq = it.value();
-    for (unsigned ii = 0; ii < qq.size(); ii++) {
-      delete qq[ii];
+  for (int iSlot = 0; iSlot < NUMSLOTS; iSlot++) {
+    t_ephList* list = _eph[iSlot].loadAcquire();
+    if (list) {
+      for (unsigned ii = 0; ii < list->_size; ii++) {
+        delete list->_eph[ii];
+      }
+      delete list;
+    }
+  }
+  for (int ii = 0; ii < _retired.size(); ii++) {
+    delete _retired[ii]._list;
+    delete _retired[ii]._eph;
+  }
+}
+
+// Slot of a satellite (-1 if out of range)
+////////////////////////////////////////////////////////////////////////////
+int bncEphUser::slotIndex(char system, int number, int flags) {
+  static const char systems[] = "GREJSCI";
+  const char* pos = (system != 0) ? strchr(systems, system) : 0;
+  if (!pos || number < 0 || number >= NUMNUMBERS || flags < 0 || flags >= NUMFLAGS) {
+    return -1;
+  }
+  return (int(pos - systems) * NUMNUMBERS + number) * NUMFLAGS + flags;
+}
+
+// Slot of a satellite given as internal string, e.g. "E11_1"
+////////////////////////////////////////////////////////////////////////////
+int bncEphUser::slotIndex(const QString& prn) {
+  if (prn.length() < 3) {
+    return -1;
+  }
+  char system = prn[0].toLatin1();
+  int  number = 0;
+  int  flags  = 0;
+  int  ii     = 1;
+  for (; ii < prn.length() && prn[ii].isDigit(); ii++) {
+    number = 10 * number + prn[ii].digitValue();
+  }
+  if (ii < prn.length() && prn[ii] == '_') {
+    for (++ii; ii < prn.length() && prn[ii].isDigit(); ii++) {
+      flags = 10 * flags + prn[ii].digitValue();
     }
   }
+  return slotIndex(system, number, flags);
+}
+
+// Satellites with at least one ephemeris
+////////////////////////////////////////////////////////////////////////////
+const QList<QString> bncEphUser::prnList() const {
+  QList<QString> prns;
+  for (int iSlot = 0; iSlot < NUMSLOTS; iSlot++) {
+    const t_ephList* list = _eph[iSlot].loadAcquire();
+    if (list && list->_size > 0) {
+      prns << QString(list->_eph[0]->prn().toInternalString().c_str());
+    }
+  }
+  return prns;
+}
+
+// Deferred deletion of a replaced list and/or a dropped ephemeris
+////////////////////////////////////////////////////////////////////////////
+void bncEphUser::retire(t_ephList* list, t_eph* eph) {
+  qint64 now = _clock.elapsed();
+  while (!_retired.isEmpty() && now - _retired.first()._time > _reclaimDelay) {
+    delete _retired.first()._list;
+    delete _retired.first()._eph;
+    _retired.removeFirst();
+  }
+  if (list || eph) {
+    t_retired retired;
+    retired._list = list;
+    retired._eph  = eph;
+    retired._time = now;
+    _retired.append(retired);
+  }
 }
 
 // New GPS Ephemeris
@@ -137,9 +207,14 @@ t_irc bncEphUser::putNewEph(t_eph* eph, bool check) {
     return failure;
   }
 
-  QString prn(newEph->prn().toInternalString().c_str());
+  int iSlot = slotIndex(newEph->prn());
+  if (iSlot < 0) {
+    delete newEph;
+    return failure;
+  }
 
-  const t_eph* ephOld = ephLast(prn);
+  t_ephList*   oldList = _eph[iSlot].loadAcquire();
+  const t_eph* ephOld  = ephAt(iSlot, 1);
 
   if (ephOld &&
       (ephOld->checkState() == t_eph::bad ||
@@ -150,12 +225,18 @@ t_irc bncEphUser::putNewEph(t_eph* eph, bool check) {
   if ((ephOld == 0 || newEph->isNewerThan(ephOld)) &&
       (eph->checkState() != t_eph::bad &&
        eph->checkState() != t_eph::outdated)) {
-    deque<t_eph*>& qq = _eph[prn];
-    qq.push_back(newEph);
-    if (qq.size() > _maxQueueSize) {
-      delete qq.front();
-      qq.pop_front();
+    t_ephList* newList = new t_ephList();
+    t_eph*     dropped = 0;
+    for (unsigned ii = 0; oldList && ii < oldList->_size; ii++) {
+      if (ii == 0 && oldList->_size == _maxQueueSize) {
+        dropped = oldList->_eph[0];
+        continue;
+      }
+      newList->_eph[newList->_size++] = oldList->_eph[ii];
     }
+    newList->_eph[newList->_size++] = newEph;
+    _eph[iSlot].storeRelease(newList);
+    retire(oldList, dropped);
     ephBufferChanged();
     return success;
   }
@@ -233,8 +314,7 @@ void bncEphUser::checkEphemeris(t_eph* eph) {
   // Check consistency with older ephemerides
   // ----------------------------------------
   const double MAXDIFF = 1000.0;
-  QString      prn     = QString(eph->prn().toInternalString().c_str());
-  t_eph*       ephL    = ephLast(prn);
+  t_eph*       ephL    = ephLast(eph->prn());
 
   if (ephL) {
     ColumnVector xcL(4);
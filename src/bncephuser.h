@@ -50,33 +50,65 @@ class bncEphUser : public QObject {
 
   t_irc putNewEph(t_eph* newEph, bool check);
 
-  t_eph* ephLast(const QString& prn) {
-    if (_eph.contains(prn)) {
-      return _eph[prn].back();
-    }
-    return 0;
-  }
+  // Readers do not lock: every satellite has an immutable list of its
+  // latest ephemerides that is replaced (atomic pointer swap) by a new
+  // one in putNewEph. Replaced lists and dropped ephemerides are deleted
+  // after _reclaimDelay ms only, pointers obtained from ephLast/ephPrev
+  // stay valid at least that long.
+  t_eph* ephLast(const t_prn& prn) const {return ephAt(slotIndex(prn), 1);}
+  t_eph* ephPrev(const t_prn& prn) const {return ephAt(slotIndex(prn), 2);}
+  t_eph* ephLast(const QString& prn) const {return ephAt(slotIndex(prn), 1);}
+  t_eph* ephPrev(const QString& prn) const {return ephAt(slotIndex(prn), 2);}
 
-  t_eph* ephPrev(const QString& prn) {
-    if (_eph.contains(prn)) {
-      unsigned nn = _eph[prn].size();
-      if (nn > 1) {
-        return _eph[prn].at(nn-2);
-      }
-    }
-    return 0;
-  }
-
-  const QList<QString> prnList() {return _eph.keys();}
+  const QList<QString> prnList() const;
 
  protected:
   virtual void ephBufferChanged() {}
 
  private:
+  static const unsigned _maxQueueSize = 5;
+  static const qint64   _reclaimDelay = 60000;
+
+  // Satellite slots: system x number x flags
+  enum {NUMSYS = 7, NUMNUMBERS = 64, NUMFLAGS = 4,
+        NUMSLOTS = NUMSYS * NUMNUMBERS * NUMFLAGS};
+
+  class t_ephList {
+   public:
+    t_ephList() {_size = 0;}
+    t_eph*   _eph[_maxQueueSize]; // oldest first
+    unsigned _size;
+  };
+
+  class t_retired {
+   public:
+    t_ephList* _list;
+    t_eph*     _eph;
+    qint64     _time;
+  };
+
+  static int slotIndex(char system, int number, int flags);
+  static int slotIndex(const t_prn& prn) {
+    return slotIndex(prn.system(), prn.number(), prn.flags());
+  }
+  static int slotIndex(const QString& prn);
+  t_eph* ephAt(int iSlot, unsigned fromBack) const {
+    if (iSlot < 0) {
+      return 0;
+    }
+    const t_ephList* list = _eph[iSlot].loadAcquire();
+    if (list && list->_size >= fromBack) {
+      return list->_eph[list->_size - fromBack];
+    }
+    return 0;
+  }
   void checkEphemeris(t_eph* eph);
-  QMutex                             _mutex;
-  static const unsigned              _maxQueueSize = 5;
-  QMap<QString, std::deque<t_eph*> > _eph;
+  void retire(t_ephList* list, t_eph* eph);
+
+  QMutex                    _mutex;
+  QAtomicPointer<t_ephList> _eph[NUMSLOTS];
+  QList<t_retired>          _retired;
+  QElapsedTimer             _clock;
 };
 
 #endif
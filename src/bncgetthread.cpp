@@ -41,12 +41,17 @@
 //#include <cstdlib>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <ctime>
 
 #include <QFile>
 #include <QTextStream>
 #include <QMutex>
 #include <QtNetwork>
 #include <QTime>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
 
 #include "bncgetthread.h"
 #include "bnctabledlg.h"
@@ -61,6 +66,7 @@
 #include "bncnetqueryudp0.h"
 #include "bncnetquerys.h"
 #include "bncsettings.h"
+#include "bncsatstatecache.h"
 #include "latencychecker.h"
 #include "upload/bncrtnetdecoder.h"
 #include "RTCM/RTCM2Decoder.h"
@@ -69,15 +75,75 @@
 
 using namespace std;
 
+// Maximum time span of raw file chunks decoded together in replay mode [s]
+////////////////////////////////////////////////////////////////////////////
+static const int REPLAY_WINDOW = 10;
+
+// Decoding of the chunks of one station within a replay block
+////////////////////////////////////////////////////////////////////////////
+class t_replayTask : public QRunnable {
+ public:
+  t_replayTask(GPSDecoder* decoder, const bncRawFile* rawFile,
+               const QVector<int>& chunkIdx, int iBeg,
+               vector< QList<t_satObs> >& obsLists) :
+    _decoder(decoder), _rawFile(rawFile), _chunkIdx(chunkIdx), _iBeg(iBeg),
+    _obsLists(obsLists) {}
+
+  // Decoding stops at the first exception, the station is reported failed
+  virtual void run() {
+    for (int ii = 0; ii < _chunkIdx.size(); ii++) {
+      const bncRawFile::t_chunk& chunk = _rawFile->chunks()[_chunkIdx[ii]];
+      vector<string> errmsg;
+      _decoder->_obsList.clear();
+      try {
+        if (_decoder->Decode(_rawFile->chunkData(chunk), chunk._nBytes, errmsg) == success) {
+          _obsLists[_chunkIdx[ii] - _iBeg] = _decoder->_obsList;
+        }
+      }
+      catch (std::exception& exc) {
+        _error = exc.what();
+        return;
+      }
+      catch (...) {
+        _error = "bncGetThread exception";
+        return;
+      }
+    }
+  }
+
+  const QByteArray& error() const {return _error;}
+
+ private:
+  GPSDecoder*                _decoder;
+  const bncRawFile*          _rawFile;
+  QVector<int>               _chunkIdx;
+  int                        _iBeg;
+  vector< QList<t_satObs> >& _obsLists;
+  QByteArray                 _error;
+};
+
+// Observations of one station and epoch in replay mode
+////////////////////////////////////////////////////////////////////////////
+class t_replayEpoch {
+ public:
+  bool operator<(const t_replayEpoch& other) const {return _time < other._time;}
+  bncTime         _time;
+  int             _iChunk;
+  QList<t_satObs> _obsList;
+};
+
 // Constructor 1
 ////////////////////////////////////////////////////////////////////////////
 bncGetThread::bncGetThread(bncRawFile* rawFile) {
 
-  _rawFile      = rawFile;
-  _format       = rawFile->format();
-  _staID        = rawFile->staID();
-  _rawOutput    = false;
-  _ntripVersion = "N";
+  bncSettings settings;
+
+  _rawFile       = rawFile;
+  _format        = rawFile->format();
+  _staID         = rawFile->staID();
+  _rawOutput     = false;
+  _ntripVersion  = "N";
+  _replayThreads = settings.value("rawReplayThreads").toInt();
 
   initialize();
 }
@@ -90,14 +156,15 @@ bncGetThread::bncGetThread(const QUrl& mountPoint,
                            const QByteArray& longitude,
                            const QByteArray& nmea,
                            const QByteArray& ntripVersion) {
-  _rawFile      = 0;
-  _mountPoint   = mountPoint;
-  _staID        = mountPoint.path().mid(1).toLatin1();
-  _format       = format;
-  _latitude     = latitude;
-  _longitude    = longitude;
-  _nmea         = nmea;
-  _ntripVersion = ntripVersion;
+  _rawFile       = 0;
+  _replayThreads = 0;
+  _mountPoint    = mountPoint;
+  _staID         = mountPoint.path().mid(1).toLatin1();
+  _format        = format;
+  _latitude      = latitude;
+  _longitude     = longitude;
+  _nmea          = nmea;
+  _ntripVersion  = ntripVersion;
 
   bncSettings settings;
   if (!settings.value("rawOutFile").toString().isEmpty()) {
@@ -320,7 +387,7 @@ t_irc bncGetThread::initDecoder() {
   else if (_format.indexOf("RTCM_3") != -1 || _format.indexOf("RTCM3") != -1 ||
            _format.indexOf("RTCM 3") != -1 ) {
     emit(newMessage(_staID + ": Get data in RTCM 3.x format", true));
-    RTCM3Decoder* newDecoder = new RTCM3Decoder(_staID, _rawFile);
+    RTCM3Decoder* newDecoder = new RTCM3Decoder(_staID, _replayThreads > 0 ? 0 : _rawFile);
     _decoder = newDecoder;
     connect((RTCM3Decoder*) newDecoder, SIGNAL(newMessage(QByteArray,bool)),
             this, SIGNAL(newMessage(QByteArray,bool)));
@@ -425,6 +492,14 @@ void bncGetThread::terminate() {
 ////////////////////////////////////////////////////////////////////////////
 void bncGetThread::run() {
 
+  if (_rawFile && _replayThreads > 0) {
+    if (_rawFile->mapFile() == success) {
+      runReplay();
+      return;
+    }
+    emit(newMessage("Cannot map raw file, replay continues sequentially", true));
+  }
+
   while (true) {
     try {
       if (_isToBeDeleted) {
@@ -575,12 +650,14 @@ void bncGetThread::run() {
         // Save observations
         // -----------------
         obsListHlp.append(obs);
+        obsListHlp.last()._staID = _staID.data();
+        t_satObsBatch::addBytesCopied(sizeof(t_satObs));
       }
 
-      // Emit signal
-      // -----------
+      // Emit signal (one shared batch for all receivers)
+      // ------------------------------------------------
       if (!_isToBeDeleted && obsListHlp.size() > 0) {
-        emit newObs(_staID, obsListHlp);
+        emit newObs(t_satObsBatchPtr(new t_satObsBatch(_staID, obsListHlp)));
       }
 
     }
@@ -595,6 +672,165 @@ void bncGetThread::run() {
   }
 }
 
+// Replay of a mapped raw file, stations are decoded in parallel
+////////////////////////////////////////////////////////////////////////////
+void bncGetThread::runReplay() {
+
+  QElapsedTimer timer;
+  timer.start();
+
+  const QVector<bncRawFile::t_chunk>& chunks = _rawFile->chunks();
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(_replayThreads);
+
+  QSet<QByteArray>  skipped;
+  qint64            nBytes    = 0;
+  long              nEpochs   = 0;
+  qint64            nCopied   = t_satObsBatch::bytesCopied();
+  bncSatStateCache* satStates = bncSatStateCache::instance();
+  qint64            nHits     = satStates->hits();
+  qint64            nMisses   = satStates->misses();
+  clock_t           cpuStart  = clock();
+
+  int iBeg = 0;
+  while (iBeg < chunks.size() && !BNC_CORE->sigintReceived) {
+
+    // Block of chunks, decoders see the time of its first chunk
+    // ---------------------------------------------------------
+    const QDateTime& begEpoch = chunks[iBeg]._epoch;
+    int iEnd = iBeg + 1;
+    while (iEnd < chunks.size() &&
+           chunks[iEnd]._epoch.date() == begEpoch.date() &&
+           begEpoch.secsTo(chunks[iEnd]._epoch) < REPLAY_WINDOW) {
+      ++iEnd;
+    }
+    BNC_CORE->setDateAndTimeGPS(begEpoch);
+
+    // Group the chunks by station, one decoder per station
+    // ----------------------------------------------------
+    QMap<QByteArray, QVector<int> > staChunks;
+    for (int ii = iBeg; ii < iEnd; ii++) {
+      const bncRawFile::t_chunk& chunk = chunks[ii];
+      if (skipped.contains(chunk._staID)) {
+        continue;
+      }
+      if (!_decodersRaw.contains(chunk._staID)) {
+        _staID  = chunk._staID;
+        _format = chunk._format;
+        if (initDecoder() != success) {
+          _isToBeDeleted = false;
+          skipped.insert(chunk._staID);
+          continue;
+        }
+      }
+      staChunks[chunk._staID].push_back(ii);
+    }
+
+    // Decode the stations in parallel, per-station order is preserved
+    // ---------------------------------------------------------------
+    vector< QList<t_satObs> > obsLists(iEnd - iBeg);
+    QMap<QByteArray, t_replayTask*> tasks;
+    QMapIterator<QByteArray, QVector<int> > itSta(staChunks);
+    while (itSta.hasNext()) {
+      itSta.next();
+      t_replayTask* task = new t_replayTask(_decodersRaw[itSta.key()], _rawFile,
+                                            itSta.value(), iBeg, obsLists);
+      task->setAutoDelete(false);
+      tasks[itSta.key()] = task;
+      pool.start(task);
+    }
+    pool.waitForDone();
+
+    // Stations whose decoder threw are skipped from now on
+    // ----------------------------------------------------
+    QMapIterator<QByteArray, t_replayTask*> itTask(tasks);
+    while (itTask.hasNext()) {
+      itTask.next();
+      if (!itTask.value()->error().isEmpty()) {
+        emit(newMessage(itTask.key() + " " + itTask.value()->error(), true));
+        skipped.insert(itTask.key());
+      }
+      delete itTask.value();
+    }
+
+    // Merge the decoded epochs in GPS time order
+    // ------------------------------------------
+    QList<t_replayEpoch> epochs;
+    for (int ii = iBeg; ii < iEnd; ii++) {
+      const bncRawFile::t_chunk& chunk = chunks[ii];
+      nBytes += chunk._nBytes;
+      emit newBytes(chunk._staID, chunk._nBytes);
+      emit newRawData(chunk._staID, QByteArray(_rawFile->chunkData(chunk), chunk._nBytes));
+
+      QListIterator<t_satObs> it(obsLists[ii - iBeg]);
+      while (it.hasNext()) {
+        const t_satObs& obs = it.next();
+        if (epochs.isEmpty() || epochs.last()._iChunk != ii || epochs.last()._time != obs._time) {
+          epochs.append(t_replayEpoch());
+          epochs.last()._time   = obs._time;
+          epochs.last()._iChunk = ii;
+        }
+        epochs.last()._obsList.append(obs);
+        epochs.last()._obsList.last()._staID = chunk._staID.data();
+        t_satObsBatch::addBytesCopied(sizeof(t_satObs));
+      }
+    }
+    std::stable_sort(epochs.begin(), epochs.end());
+
+    for (int ie = 0; ie < epochs.size(); ie++) {
+      const t_replayEpoch&       epoch = epochs[ie];
+      const bncRawFile::t_chunk& chunk = chunks[epoch._iChunk];
+      _staID  = chunk._staID;
+      _format = chunk._format;
+      BNC_CORE->setDateAndTimeGPS(chunk._epoch);
+      GPSDecoder* decoder = _decodersRaw[_staID];
+      QListIterator<t_satObs> it(epoch._obsList);
+      while (it.hasNext()) {
+        decoder->dumpRinexEpoch(it.next(), _format);
+      }
+      emit newObs(t_satObsBatchPtr(new t_satObsBatch(_staID, epoch._obsList)));
+    }
+    nEpochs += epochs.size();
+
+    QCoreApplication::processEvents();
+
+    iBeg = iEnd;
+  }
+
+  // Throughput report
+  // -----------------
+  double sec = timer.elapsed() / 1000.0;
+  if (sec <= 0.0) {
+    sec = 0.001;
+  }
+  nCopied = t_satObsBatch::bytesCopied() - nCopied;
+  nHits   = satStates->hits()   - nHits;
+  nMisses = satStates->misses() - nMisses;
+  QString report = QString("Raw file replay: %1 chunks, %2 stations, %3 MB, "
+                           "%4 station epochs in %5 s (%6 MB/s, %7 epochs/s), "
+                           "%8 threads, %9 bytes of observations copied per epoch")
+                   .arg(chunks.size()).arg(_decodersRaw.size())
+                   .arg(nBytes / 1.e6, 0, 'f', 1).arg(nEpochs)
+                   .arg(sec, 0, 'f', 1).arg(nBytes / 1.e6 / sec, 0, 'f', 2)
+                   .arg(nEpochs / sec, 0, 'f', 1).arg(_replayThreads)
+                   .arg(nEpochs ? nCopied / nEpochs : 0);
+  if (nHits + nMisses > 0) {
+    report += QString(", satellite states: %1 evaluated, %2% served from cache, "
+                      "%3 ms CPU per station epoch")
+              .arg(nMisses).arg(100.0 * nHits / (nHits + nMisses), 0, 'f', 1)
+              .arg(nEpochs ? 1000.0 * (clock() - cpuStart) / CLOCKS_PER_SEC / nEpochs : 0.0,
+                   0, 'f', 2);
+  }
+  emit(newMessage(report.toLatin1(), true));
+  cout << report.toStdString() << endl;
+
+  cout << "no more data or Ctrl-C received" << endl;
+  BNC_CORE->stopCombination();
+  BNC_CORE->stopPPP();
+  ::exit(0);
+}
+
 // Try Re-Connect
 ////////////////////////////////////////////////////////////////////////////
 t_irc bncGetThread::tryReconnect() {
@@ -738,9 +974,9 @@ void bncGetThread::miscScanRTCM() {
         QVector<QString>& rnxTypes = _rnxTypes[obs._prn.system()];
         bool allFound = true;
         for (unsigned iFrq = 0; iFrq < obs._obs.size(); iFrq++) {
-          if (obs._obs[iFrq]->_codeValid) {
+          if (obs._obs[iFrq]._codeValid) {
             QString rnxStr('C');
-            rnxStr.append(obs._obs[iFrq]->_rnxType2ch.c_str());
+            rnxStr.append(obs._obs[iFrq]._rnxType2ch.c_str());
             if (_format.indexOf("RTCM_2") != -1 ||
                 _format.indexOf("RTCM2") != -1 ||
                 _format.indexOf("RTCM 2") != -1 ) {
@@ -751,9 +987,9 @@ void bncGetThread::miscScanRTCM() {
               allFound = false;
             }
           }
-          if (obs._obs[iFrq]->_phaseValid) {
+          if (obs._obs[iFrq]._phaseValid) {
             QString rnxStr('L');
-            rnxStr.append(obs._obs[iFrq]->_rnxType2ch.c_str());
+            rnxStr.append(obs._obs[iFrq]._rnxType2ch.c_str());
             if (_format.indexOf("RTCM_2") != -1 ||
                 _format.indexOf("RTCM2") != -1 ||
                 _format.indexOf("RTCM 2") != -1 ) {
@@ -764,9 +1000,9 @@ void bncGetThread::miscScanRTCM() {
               allFound = false;
             }
           }
-          if (obs._obs[iFrq]->_dopplerValid){
+          if (obs._obs[iFrq]._dopplerValid){
             QString rnxStr('D');
-            rnxStr.append(obs._obs[iFrq]->_rnxType2ch.c_str());
+            rnxStr.append(obs._obs[iFrq]._rnxType2ch.c_str());
             if (_format.indexOf("RTCM_2") != -1 ||
                 _format.indexOf("RTCM2") != -1 ||
                 _format.indexOf("RTCM 2") != -1 ) {
@@ -777,9 +1013,9 @@ void bncGetThread::miscScanRTCM() {
               allFound = false;
             }
           }
-          if (obs._obs[iFrq]->_snrValid){
+          if (obs._obs[iFrq]._snrValid){
             QString rnxStr('S');
-            rnxStr.append(obs._obs[iFrq]->_rnxType2ch.c_str());
+            rnxStr.append(obs._obs[iFrq]._rnxType2ch.c_str());
             if (_format.indexOf("RTCM_2") != -1 ||
                 _format.indexOf("RTCM2") != -1 ||
                 _format.indexOf("RTCM 2") != -1 ) {
@@ -78,7 +78,7 @@ class bncGetThread : public QThread {
    void newBytes(QByteArray staID, double nbyte);
    void newRawData(QByteArray staID, QByteArray data);
    void newLatency(QByteArray staID, double clate);
-   void newObs(QByteArray staID, QList<t_satObs> obsList);
+   void newObs(t_satObsBatchPtr obsBatch);
    void newAntCrd(QByteArray staID, double xx, double yy, double zz, 
                   double hh, QByteArray antType);
    void newMessage(QByteArray msg, bool showOnScreen);
@@ -103,6 +103,7 @@ class bncGetThread : public QThread {
    void  initialize();
    t_irc tryReconnect();
    void  miscScanRTCM();
+   void  runReplay();
 
    QMap<QString, GPSDecoder*> _decodersRaw;
    GPSDecoder*                _decoder;
@@ -121,6 +122,7 @@ class bncGetThread : public QThread {
    int                        _nextSleep;
    int                        _iMount;
    bncRawFile*                _rawFile;
+   int                        _replayThreads;
    QextSerialPort*            _serialPort;
    bool                       _isToBeDeleted;
    latencyChecker*            _latencyChecker;
@@ -0,0 +1,130 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      bncGpsTime
+ *
+ * Purpose:    Cached real-time GPS clock for the per-observation and
+ *             per-satellite time checks
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include "bncgpstime.h"
+#include "bncutils.h"
+
+// Synchronization interval with the system clock [ms], milliseconds per
+// GPS week
+////////////////////////////////////////////////////////////////////////////
+static const qint64 SYNC_INTERVAL = 60000;
+static const qint64 MSEC_PER_WEEK = 7 * 86400 * qint64(1000);
+
+// Instance
+////////////////////////////////////////////////////////////////////////////
+bncGpsTime* bncGpsTime::instance() {
+  static bncGpsTime _gpsTime;
+  return &_gpsTime;
+}
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+bncGpsTime::bncGpsTime() : _offset(0), _nextSync(0) {
+  _timer.start();
+  sync(_timer.elapsed(), true);
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+bncGpsTime::~bncGpsTime() {
+}
+
+// Offset between GPS time and the monotonic timer from the system clock,
+// only one of several concurrent callers performs the synchronization
+////////////////////////////////////////////////////////////////////////////
+void bncGpsTime::sync(qint64 elapsed, bool force) {
+
+  if (!force) {
+    qint64 nextSync = _nextSync.loadAcquire();
+    if (elapsed < nextSync ||
+        !_nextSync.testAndSetOrdered(nextSync, elapsed + SYNC_INTERVAL)) {
+      return;
+    }
+  }
+
+  static const QDateTime zeroEpoch(QDate(1980, 1, 6), QTime(0, 0, 0), Qt::UTC);
+
+  QDateTime currDateTime = QDateTime::currentDateTimeUtc();
+  QDate     currDate     = currDateTime.date();
+  qint64    gpsMsec      = zeroEpoch.msecsTo(currDateTime) +
+                           1000 * gnumleap(currDate.year(), currDate.month(), currDate.day());
+  qint64    now          = _timer.elapsed();
+  _offset.storeRelease(gpsMsec - now);
+
+  // Next synchronization at the latest right after UTC midnight (leap seconds)
+  // --------------------------------------------------------------------------
+  qint64 toMidnight = currDateTime.msecsTo(QDateTime(currDate.addDays(1), QTime(0, 0, 0), Qt::UTC));
+  _nextSync.storeRelease(now + qMin(SYNC_INTERVAL, toMidnight + 1));
+}
+
+// Current GPS time since 6-Jan-1980 [ms]
+////////////////////////////////////////////////////////////////////////////
+qint64 bncGpsTime::msec() {
+  qint64 elapsed = _timer.elapsed();
+  if (elapsed >= _nextSync.loadAcquire()) {
+    sync(elapsed, false);
+  }
+  return _offset.loadAcquire() + elapsed;
+}
+
+// Current GPS week and seconds of week
+////////////////////////////////////////////////////////////////////////////
+void bncGpsTime::currentGPSWeeks(int& week, double& sec) {
+  qint64 gpsMsec = msec();
+  week = int(gpsMsec / MSEC_PER_WEEK);
+  sec  = (gpsMsec % MSEC_PER_WEEK) / 1000.0;
+}
+
+// Current GPS date and time, the conversion is done once per millisecond
+// and thread
+////////////////////////////////////////////////////////////////////////////
+QDateTime bncGpsTime::currentDateAndTime() {
+
+  static thread_local qint64    cachedMsec = -1;
+  static thread_local QDateTime cachedDateTime;
+
+  qint64 gpsMsec = msec();
+  if (gpsMsec != cachedMsec) {
+    cachedMsec     = gpsMsec;
+    cachedDateTime = dateAndTimeFromGPSweek(int(gpsMsec / MSEC_PER_WEEK),
+                                            (gpsMsec % MSEC_PER_WEEK) / 1000.0);
+  }
+  return cachedDateTime;
+}
@@ -0,0 +1,54 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+#ifndef BNCGPSTIME_H
+#define BNCGPSTIME_H
+
+#include <QtCore>
+
+// Process-wide real-time GPS clock. The offset between GPS time and a
+// monotonic timer is taken from the system clock and the leap second
+// table once a minute and at each UTC midnight; in between, reading the
+// time is lock-free and costs one monotonic clock query.
+////////////////////////////////////////////////////////////////////////////
+class bncGpsTime {
+ public:
+  static bncGpsTime* instance();
+
+  qint64    msec();
+  void      currentGPSWeeks(int& week, double& sec);
+  QDateTime currentDateAndTime();
+
+ private:
+  bncGpsTime();
+  ~bncGpsTime();
+  void sync(qint64 elapsed, bool force);
+
+  QElapsedTimer          _timer;
+  QAtomicInteger<qint64> _offset;    // GPS time minus _timer.elapsed() [ms]
+  QAtomicInteger<qint64> _nextSync;  // _timer.elapsed() of the next sync [ms]
+};
+
+#endif
@@ -74,6 +74,7 @@ int main(int argc, char* argv[]) {
   bool       displaySet   = false;
 #endif
   QByteArray rawFileName;
+  QByteArray convFileName;
   QString    confFileName;
 
   QByteArray printHelp =
@@ -84,6 +85,7 @@ int main(int argc, char* argv[]) {
       "       --display {name}\n"
       "       --conf {confFileName}\n"
       "       --file {rawFileName}\n"
+      "       --convert {outputFileName} (together with --file)\n"
       "       --key  {keyName} {keyValue}\n"
       "\n"
       "Network Panel keys:\n"
@@ -98,6 +100,9 @@ int main(int argc, char* argv[]) {
       "   onTheFlyInterval {Configuration reload interval [character string: 1 day|1 hour|5 min|1 min]}\n"
       "   autoStart        {Auto start [integer number: 0=no,2=yes]}\n"
       "   rawOutFile       {Raw output file, full path [character string]}\n"
+      "   rawReplayThreads {Threads for parallel decoding of a raw input file given by --file [integer number: 0=serial]}\n"
+      "   rawReplayStart   {Skip raw input file data before this epoch [character string: yyyy-MM-ddThh:mm:ss]}\n"
+      "   rawReplayStations {Read only these stations from the raw input file [character string, comma separated list]}\n"
       "\n"
       "RINEX Observations Panel keys:\n"
       "   rnxPath        {Directory [character string]}\n"
@@ -164,10 +169,14 @@ int main(int argc, char* argv[]) {
       "\n"
       "Feed Engine Panel keys:\n"
       "   outPort  {Output port, synchronized [integer number]}\n"
+      "   outFormat {Output port format, synchronized [character string: ascii|binary]}\n"
       "   outWait  {Wait for full observation epoch [integer number of seconds: 1-30]}\n"
       "   outSampl {Sampling rate [integer number of seconds: 0|5|10|15|20|25|30|35|40|45|50|55|60]}\n"
       "   outFile  {Output file, full path [character string]}\n"
       "   outUPort {Output port, unsynchronized [integer number]}\n"
+      "   outUFormat {Output port format, unsynchronized [character string: ascii|binary]}\n"
+      "   outQueueSize     {Output queue per port client [integer number of kB]}\n"
+      "   outQueueOverflow {Action on output queue overflow [character string: drop|disconnect]}\n"
       "\n"
       "Serial Output Panel:\n"
       "   serialMountPoint         {Mountpoint [character string]}\n"
@@ -197,6 +206,7 @@ int main(int argc, char* argv[]) {
       "PPP Client Panel 1 keys:\n"
       "   PPP/dataSource  {Data source [character string: Blank|Real-Time Streams|RINEX Files]}\n"
       "   PPP/rinexObs    {RINEX observation file, full path [character string]}\n"
+      "   PPP/rinexObsBatch {RINEX observation files of a batch run, comma separated list, wildcards allowed [character string]}\n"
       "   PPP/rinexNav    {RINEX navigation file, full path [character string]}\n"
       "   PPP/corrMount   {Corrections mountpoint [character string]}\n"
       "   PPP/corrFile    {Corrections file, full path [character string]}\n"
@@ -230,6 +240,11 @@ int main(int argc, char* argv[]) {
       "   PPP/minEle       {Minimum satellite elevation in degrees [integer number: 0-20]}\n"
       "   PPP/corrWaitTime {Wait for clock corrections [integer number of seconds: 0-20]}\n"
       "   PPP/seedingTime  {Seeding time span for Quick Start [integer number of seconds]}\n"
+      "   PPP/filter       {Kalman filter update [character string: QR|Joseph]}\n"
+      "   PPP/filterTiming {Report time of each filter update [integer number: 0=no,2=yes]}\n"
+      "   PPP/outlierMode  {Outlier rejection [character string: resolve|downdate]}\n"
+      "   PPP/smoothing    {Backward smoothing of post-processing PPP [integer number: 0=no,2=yes]}\n"
+      "   PPP/workerThreads {Worker threads for real-time PPP, 0=one thread per station [integer number]}\n"
       "\n"
       "PPP Client Panel 4 keys:\n"
       "   PPP/plotCoordinates  {Mountpoint for time series plot [character string]}\n"
@@ -243,10 +258,11 @@ int main(int argc, char* argv[]) {
       "Combine Corrections Panel keys:\n"
       "   cmbStreams      {Correction streams table [character string, semicolon separated list, each element in quotation marks, example:\n"
       "                   \"IGS01 ESA 1.0;IGS03 BKG 1.0\"]}\n"
-      "   cmbMethodFilter {Combination approach [character string: Single-Epoch|Filter]\n"
+      "   cmbMethodFilter {Combination approach [character string: Single-Epoch|Filter|Sparse-Filter]\n"
       "   cmbMaxres       {Clock outlier residuum threshold in meters [floating-point number]\n"
       "   cmbSampl        {Clock sampling rate [integer number of seconds: 10|20|30|40|50|60]}\n"
       "   cmbUseGlonass   {Use GLONASS in combination [integer number: 0=no,2=yes]\n"
+      "   cmbTiming       {Report processing time per epoch [integer number: 0=no,2=yes]}\n"
       "\n"
       "Upload Corrections Panel keys:\n"
       "   uploadMountpointsOut   {Upload corrections table [character string, semicolon separated list, each element in quotation marks, example:\n"
@@ -339,9 +355,17 @@ int main(int argc, char* argv[]) {
         interactive = false;
         rawFileName = QByteArray(argv[ii+1]);
       }
+      if (QRegExp("--?convert").exactMatch(argv[ii])) {
+        convFileName = QByteArray(argv[ii+1]);
+      }
     }
   }
 
+  if (!convFileName.isEmpty() && rawFileName.isEmpty()) {
+    cout << "Option --convert requires --file {rawFileName}" << endl;
+    exit(1);
+  }
+
 #ifdef Q_OS_MAC
   if (argc== 3 && interactive) {
     confFileName = QString(argv[2]);
@@ -482,6 +506,15 @@ int main(int argc, char* argv[]) {
 
     // Special case - data from file
     // -----------------------------
+    else if ( !convFileName.isEmpty() ) {
+      BNC_CORE->setMode(t_bncCore::batchPostProcessing);
+      if (bncRawFile::convert(rawFileName, convFileName) == success) {
+        cout << "Raw file converted: " << convFileName.data() << endl;
+        exit(0);
+      }
+      cout << "Cannot convert raw file " << rawFileName.data() << endl;
+      exit(1);
+    }
     else {
       BNC_CORE->sigintReceived = 0;
       BNC_CORE->setMode(t_bncCore::batchPostProcessing);
@@ -30,10 +30,86 @@
 #include "bncsettings.h"
 
 #include <QString>
+#include <QRegExp>
+#include <QtEndian>
+#include <string.h>
 
 using namespace std;
 
-#define RAW_FILE_VERSION "1"
+#define RAW_FILE_VERSION "3"
+
+// Binary layout of version 3 raw files (little endian)
+//
+//   "3 Version of BNC raw file\n"
+//   chunk:  "BRC3" jd(4) msecOfDay(4) nBytes(4) staID(24) format(24), data
+//   index:  "BRI3" nEntries(4) prevIndexOffset(8),
+//           nEntries x (chunkOffset(8) jd(4) msecOfDay(4) nBytes(4)
+//                       staID(24) format(24))
+//   footer: "BRF3" nChunks(4) lastIndexOffset(8)
+//
+// An index block is written every INDEX_INTERVAL chunks and when the file
+// is closed, the footer is written when the file is closed.
+////////////////////////////////////////////////////////////////////////////
+static const char   CHUNK_MAGIC[]     = "BRC3";
+static const char   INDEX_MAGIC[]     = "BRI3";
+static const char   FOOTER_MAGIC[]    = "BRF3";
+static const int    ID_SIZE           = 24;
+static const int    CHUNK_HEADER_SIZE = 16 + 2 * ID_SIZE;
+static const int    INDEX_HEADER_SIZE = 16;
+static const int    INDEX_ENTRY_SIZE  = 20 + 2 * ID_SIZE;
+static const int    FOOTER_SIZE       = 16;
+static const int    INDEX_INTERVAL    = 256;
+
+// Helpers for the binary layout
+////////////////////////////////////////////////////////////////////////////
+static void putInt32(char* buf, qint32 val) {
+  qToLittleEndian<qint32>(val, reinterpret_cast<uchar*>(buf));
+}
+
+static void putInt64(char* buf, qint64 val) {
+  qToLittleEndian<qint64>(val, reinterpret_cast<uchar*>(buf));
+}
+
+static qint32 getInt32(const char* buf) {
+  return qFromLittleEndian<qint32>(reinterpret_cast<const uchar*>(buf));
+}
+
+static qint64 getInt64(const char* buf) {
+  return qFromLittleEndian<qint64>(reinterpret_cast<const uchar*>(buf));
+}
+
+// IDs are stored zero-terminated, longer ones have to be rejected by the
+// caller (see validIDs)
+static void putID(char* buf, const QByteArray& id) {
+  memset(buf, 0, ID_SIZE);
+  memcpy(buf, id.data(), qMin(id.size(), ID_SIZE - 1));
+}
+
+static QByteArray getID(const char* buf) {
+  return QByteArray(buf, qstrnlen(buf, ID_SIZE));
+}
+
+static bool validIDs(const QByteArray& staID, const QByteArray& format) {
+  return staID.size() < ID_SIZE && format.size() < ID_SIZE;
+}
+
+// jd, msecOfDay, nBytes, staID, format (chunk header without magic)
+static void putChunkInfo(char* buf, const QDateTime& epoch, int nBytes,
+                         const QByteArray& staID, const QByteArray& format) {
+  putInt32(buf,      epoch.date().toJulianDay());
+  putInt32(buf + 4,  QTime(0,0,0,0).msecsTo(epoch.time()));
+  putInt32(buf + 8,  nBytes);
+  putID   (buf + 12, staID);
+  putID   (buf + 12 + ID_SIZE, format);
+}
+
+static void getChunkInfo(const char* buf, bncRawFile::t_chunk& chunk) {
+  chunk._epoch  = QDateTime(QDate::fromJulianDay(getInt32(buf)),
+                            QTime(0,0,0,0).addMSecs(getInt32(buf + 4)));
+  chunk._nBytes = getInt32(buf + 8);
+  chunk._staID  = getID(buf + 12);
+  chunk._format = getID(buf + 12 + ID_SIZE);
+}
 
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
@@ -46,6 +122,14 @@ bncRawFile::bncRawFile(const QByteArray& fileName, const QByteArray& staID,
   _inpFile    = 0;
   _outFile    = 0;
   _version    = 0;
+  _outVersion = 0;
+  _mapped     = 0;
+  _indexRead  = false;
+  _iChunk     = 0;
+  _dataStart  = 0;
+  _scanEnd    = 0;
+  _nChunksOut = 0;
+  _lastIndexOffset = -1;
 
   // Initialize for Input
   // --------------------
@@ -55,6 +139,18 @@ bncRawFile::bncRawFile(const QByteArray& fileName, const QByteArray& staID,
     QString     line = _inpFile->readLine();
     QStringList lst  = line.split(' ');
     _version = lst.value(0).toInt();
+    _dataStart = _inpFile->pos();
+
+    bncSettings settings;
+    QString startStr = settings.value("rawReplayStart").toString();
+    if (!startStr.isEmpty()) {
+      _startTime = QDateTime::fromString(startStr, Qt::ISODate);
+    }
+    QStringList staList = settings.value("rawReplayStations").toString()
+                                  .split(QRegExp("[ ,]"), QString::SkipEmptyParts);
+    for (int ii = 0; ii < staList.size(); ii++) {
+      _staFilter.insert(staList[ii].toLatin1());
+    }
   }
 
   // Initialize for Output
@@ -62,24 +158,153 @@ bncRawFile::bncRawFile(const QByteArray& fileName, const QByteArray& staID,
   else {    
     QDate currDate = currentDateAndTimeGPS().date();
     _currentFileName = _fileName + "_" + currDate.toString("yyMMdd");
-    _outFile = new QFile(_currentFileName);     
     bncSettings settings;
-    if ( Qt::CheckState(settings.value("rnxAppend").toInt()) == Qt::Checked &&
-         QFile::exists(_currentFileName) ) {
+    openOutput(_currentFileName,
+               Qt::CheckState(settings.value("rnxAppend").toInt()) == Qt::Checked);
+  }
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+bncRawFile::~bncRawFile() {
+  delete _inpFile;
+  closeOutput();
+}
+
+// Open the output file, an existing file is continued in its own version
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::openOutput(const QString& fileName, bool append) {
+
+  _outFile         = new QFile(fileName);
+  _outVersion      = QByteArray(RAW_FILE_VERSION).toInt();
+  _nChunksOut      = 0;
+  _lastIndexOffset = -1;
+  _pendingIndex.clear();
+
+  int oldVersion = 0;
+  if (append && QFile::exists(fileName)) {
+    QFile oldFile(fileName);
+    if (oldFile.open(QIODevice::ReadOnly)) {
+      oldVersion = QString(oldFile.readLine()).split(' ').value(0).toInt();
+    }
+  }
+
+  if (oldVersion > 0) {
+    _outVersion = oldVersion;
+
+    // Version 3: drop the footer, chunks not covered by the index chain
+    // are re-indexed
+    // -----------------------------------------------------------------
+    if (_outVersion >= 3) {
+      bncRawFile old(fileName.toLatin1(), "", input);
+      bool   complete = (old.readIndex() == success);
+      qint64 end      = old._inpFile->size();
+      if (complete) {
+        end -= FOOTER_SIZE;
+        _nChunksOut      = old._chunks.size();
+        _lastIndexOffset = old._lastIndexOffset;
+      }
+      else {
+        old.scanChunks();
+        end = old._scanEnd;
+        for (int ii = 0; ii < old._chunks.size(); ii++) {
+          const t_chunk& chunk = old._chunks[ii];
+          appendIndexEntry(chunk._offset - CHUNK_HEADER_SIZE, chunk._epoch,
+                           chunk._nBytes, chunk._staID, chunk._format);
+        }
+      }
+      delete old._inpFile; old._inpFile = 0;
+      _outFile->open(QIODevice::ReadWrite);
+      _outFile->resize(end);
+      _outFile->seek(end);
+      if (!complete) {
+        writeIndexBlock();
+      }
+    }
+    else {
       _outFile->open(QIODevice::WriteOnly | QIODevice::Append);
     }
+  }
+  else {
+    _outFile->open(QIODevice::WriteOnly);
+    if (_outVersion >= 3) {
+      _outFile->write(RAW_FILE_VERSION " Version of BNC raw file\n");
+    }
     else {
-      _outFile->open(QIODevice::WriteOnly);
       _outFile->write(RAW_FILE_VERSION " Version of BNC raw file");
     }
   }
 }
 
-// Destructor
+// Write pending index entries and the footer, close the output file
 ////////////////////////////////////////////////////////////////////////////
-bncRawFile::~bncRawFile() {
-  delete _inpFile;
-  delete _outFile;
+void bncRawFile::closeOutput() {
+  if (_outFile) {
+    if (_outVersion >= 3 && _outFile->isOpen()) {
+      writeIndexBlock();
+      char footer[FOOTER_SIZE];
+      memcpy(footer, FOOTER_MAGIC, 4);
+      putInt32(footer + 4, _nChunksOut);
+      putInt64(footer + 8, _lastIndexOffset);
+      _outFile->write(footer, FOOTER_SIZE);
+    }
+    delete _outFile;
+    _outFile = 0;
+  }
+}
+
+// Remember a chunk for the next index block
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::appendIndexEntry(qint64 offset, const QDateTime& epoch, int nBytes,
+                                  const QByteArray& staID, const QByteArray& format) {
+  char entry[INDEX_ENTRY_SIZE];
+  putInt64(entry, offset);
+  putChunkInfo(entry + 8, epoch, nBytes, staID, format);
+  _pendingIndex.append(entry, INDEX_ENTRY_SIZE);
+  ++_nChunksOut;
+}
+
+// Write the index block of the pending entries
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::writeIndexBlock() {
+  int nEntries = _pendingIndex.size() / INDEX_ENTRY_SIZE;
+  if (nEntries == 0) {
+    return;
+  }
+  char header[INDEX_HEADER_SIZE];
+  memcpy(header, INDEX_MAGIC, 4);
+  putInt32(header + 4, nEntries);
+  putInt64(header + 8, _lastIndexOffset);
+  _lastIndexOffset = _outFile->pos();
+  _outFile->write(header, INDEX_HEADER_SIZE);
+  _outFile->write(_pendingIndex);
+  _pendingIndex.clear();
+}
+
+// Write one chunk
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::writeChunk(const QDateTime& epoch, const QByteArray& data,
+                            const QByteArray& staID, const QByteArray& format) {
+  if (_outVersion >= 3) {
+    char header[CHUNK_HEADER_SIZE];
+    memcpy(header, CHUNK_MAGIC, 4);
+    putChunkInfo(header + 4, epoch, data.size(), staID, format);
+    appendIndexEntry(_outFile->pos(), epoch, data.size(), staID, format);
+    _outFile->write(header, CHUNK_HEADER_SIZE);
+    _outFile->write(data);
+    if (_pendingIndex.size() >= INDEX_INTERVAL * INDEX_ENTRY_SIZE) {
+      writeIndexBlock();
+    }
+  }
+  else {
+    QString chunkHeader = QString("\n%1 %2 %3 %4\n")
+                 .arg(epoch.toString(Qt::ISODate))
+                 .arg(QString(staID))
+                 .arg(QString(format))
+                 .arg(data.size());
+    _outFile->write(chunkHeader.toLatin1());
+    _outFile->write(data);
+  }
 }
 
 // Raw Output
@@ -87,27 +312,42 @@ bncRawFile::~bncRawFile() {
 void bncRawFile::writeRawData(const QByteArray& data, const QByteArray& staID,
                               const QByteArray& format) {
   if (_outFile) {
-    QDate currDate = currentDateAndTimeGPS().date();
-    QString hlp = _fileName + "_" + currDate.toString("yyMMdd");
+    QDateTime epoch = currentDateAndTimeGPS();
+    QString hlp = _fileName + "_" + epoch.date().toString("yyMMdd");
     if (hlp != _currentFileName) {
       _currentFileName = hlp;
-      delete _outFile;
-      _outFile = new QFile(_currentFileName);
-      _outFile->open(QIODevice::WriteOnly);
-      _outFile->write(RAW_FILE_VERSION " Version of BNC raw file");
+      closeOutput();
+      openOutput(_currentFileName, false);
     }
 
-    QString chunkHeader = QString("\n%1 %2 %3 %4\n")
-                 .arg(currentDateAndTimeGPS().toString(Qt::ISODate))
-                 .arg(QString(staID))
-                 .arg(QString(format))
-                 .arg(data.size());
-    _outFile->write(chunkHeader.toLatin1());
-    _outFile->write(data);
+    // Over-long IDs cannot be stored in version 3 (reported once)
+    // ----------------------------------------------------------
+    if (_outVersion >= 3 && !validIDs(staID, format)) {
+      if (!_rejectedIDs.contains(staID)) {
+        _rejectedIDs.insert(staID);
+        BNC_CORE->slotMessage("bncRawFile: " + staID + " " + format
+                              + ": ID longer than " + QByteArray::number(ID_SIZE - 1)
+                              + " characters, not written to raw file", true);
+      }
+      return;
+    }
+
+    writeChunk(epoch, data, staID, format);
     _outFile->flush();
   }
 }
 
+// Check the replay filter (start time, station subset)
+////////////////////////////////////////////////////////////////////////////
+bool bncRawFile::selected(const t_chunk& chunk) const {
+  if (_startTime.isValid() && chunk._epoch < _startTime) {
+    return false;
+  }
+  if (!_staFilter.isEmpty() && !_staFilter.contains(chunk._staID)) {
+    return false;
+  }
+  return true;
+}
 
 // Raw Input
 ////////////////////////////////////////////////////////////////////////////
@@ -115,26 +355,307 @@ QByteArray bncRawFile::readChunk(){
 
   QByteArray data;
 
-  if (_inpFile) {
+  if (!_inpFile) {
+    return data;
+  }
+
+  // Version 3: walk through the (filtered) index
+  // --------------------------------------------
+  if (_version >= 3) {
+    if (!_indexRead) {
+      buildIndex();
+    }
+    if (_iChunk < _chunks.size()) {
+      const t_chunk& chunk = _chunks[_iChunk++];
+      BNC_CORE->setDateAndTimeGPS(chunk._epoch);
+      _staID  = chunk._staID;
+      _format = chunk._format;
+      if (_inpFile->pos() != chunk._offset) {
+        _inpFile->seek(chunk._offset);
+      }
+      data = _inpFile->read(chunk._nBytes);
+    }
+    return data;
+  }
+
+  // Version 1: text headers
+  // -----------------------
+  while (data.isEmpty()) {
     QString     line = _inpFile->readLine();
     if (line.indexOf("Version of BNC raw file") != -1) {
       line = _inpFile->readLine();
     }
-    if (!line.isEmpty()) {
-      QStringList lst  = line.split(' ');
-      
-      BNC_CORE->setDateAndTimeGPS(QDateTime(QDateTime::fromString(lst.value(0), Qt::ISODate)));
-      
-      _staID  = lst.value(1).toLatin1();
-      _format = lst.value(2).toLatin1();
-      int nBytes = lst.value(3).toInt();
-      
-      data = _inpFile->read(nBytes);
-      
-      _inpFile->read(1); // read '\n' character
+    if (line.isEmpty()) {
+      break;
+    }
+    QStringList lst  = line.split(' ');
+
+    t_chunk chunk;
+    chunk._epoch  = QDateTime::fromString(lst.value(0), Qt::ISODate);
+    chunk._staID  = lst.value(1).toLatin1();
+    chunk._format = lst.value(2).toLatin1();
+    chunk._nBytes = lst.value(3).toInt();
+
+    if (!selected(chunk)) {
+      _inpFile->seek(_inpFile->pos() + chunk._nBytes + 1);
+      continue;
     }
+
+    BNC_CORE->setDateAndTimeGPS(chunk._epoch);
+
+    _staID  = chunk._staID;
+    _format = chunk._format;
+
+    data = _inpFile->read(chunk._nBytes);
+
+    _inpFile->read(1); // read '\n' character
   }
 
   return data;
 }
 
+// Build the (filtered) index of all chunks
+////////////////////////////////////////////////////////////////////////////
+t_irc bncRawFile::buildIndex() {
+
+  if (!_inpFile || !_inpFile->isOpen()) {
+    return failure;
+  }
+
+  _indexRead = true;
+  _iChunk    = 0;
+
+  if (_version >= 3) {
+    if (readIndex() != success) {
+      scanChunks();
+    }
+  }
+  else {
+    scanChunksV1();
+  }
+
+  // Apply the filter, seek to the start time
+  // ----------------------------------------
+  if (_startTime.isValid() || !_staFilter.isEmpty()) {
+    QVector<t_chunk> chunks;
+    for (int ii = 0; ii < _chunks.size(); ii++) {
+      if (selected(_chunks[ii])) {
+        chunks.push_back(_chunks[ii]);
+      }
+    }
+    _chunks = chunks;
+  }
+
+  return success;
+}
+
+// Read the index blocks of a version 3 file, starting from the footer
+////////////////////////////////////////////////////////////////////////////
+t_irc bncRawFile::readIndex() {
+
+  _chunks.clear();
+
+  qint64 size = _inpFile->size();
+  if (size < _dataStart + FOOTER_SIZE) {
+    return failure;
+  }
+
+  char footer[FOOTER_SIZE];
+  _inpFile->seek(size - FOOTER_SIZE);
+  if (_inpFile->read(footer, FOOTER_SIZE) != FOOTER_SIZE ||
+      memcmp(footer, FOOTER_MAGIC, 4) != 0) {
+    return failure;
+  }
+  int    nChunks     = getInt32(footer + 4);
+  qint64 indexOffset = getInt64(footer + 8);
+
+  // Index blocks are chained backwards
+  // ----------------------------------
+  // (each block has to end before the one read last, so a corrupt chain
+  //  cannot loop; otherwise fall back to the sequential scan)
+  // --------------------------------------------------------------------
+  if (nChunks < 0) {
+    return failure;
+  }
+  QList<QByteArray> blocks;
+  int    nEntries   = 0;
+  qint64 blockLimit = size - FOOTER_SIZE;
+  while (indexOffset >= _dataStart) {
+    if (indexOffset + INDEX_HEADER_SIZE > blockLimit) {
+      return failure;
+    }
+    char header[INDEX_HEADER_SIZE];
+    _inpFile->seek(indexOffset);
+    if (_inpFile->read(header, INDEX_HEADER_SIZE) != INDEX_HEADER_SIZE ||
+        memcmp(header, INDEX_MAGIC, 4) != 0) {
+      return failure;
+    }
+    int nn = getInt32(header + 4);
+    if (nn < 0 || nn > nChunks - nEntries ||
+        indexOffset + INDEX_HEADER_SIZE + qint64(nn) * INDEX_ENTRY_SIZE > blockLimit) {
+      return failure;
+    }
+    QByteArray block = _inpFile->read(qint64(nn) * INDEX_ENTRY_SIZE);
+    if (block.size() != nn * INDEX_ENTRY_SIZE) {
+      return failure;
+    }
+    blocks.prepend(block);
+    nEntries   += nn;
+    blockLimit  = indexOffset;
+    indexOffset = getInt64(header + 8);
+    if (indexOffset >= blockLimit) {
+      return failure;
+    }
+  }
+  if (nEntries != nChunks) {
+    return failure;
+  }
+
+  _chunks.reserve(nChunks);
+  for (int ib = 0; ib < blocks.size(); ib++) {
+    const char* entry = blocks[ib].constData();
+    for (int ie = 0; ie < blocks[ib].size() / INDEX_ENTRY_SIZE; ie++) {
+      t_chunk chunk;
+      chunk._offset = getInt64(entry) + CHUNK_HEADER_SIZE;
+      getChunkInfo(entry + 8, chunk);
+      _chunks.push_back(chunk);
+      entry += INDEX_ENTRY_SIZE;
+    }
+  }
+  _lastIndexOffset = getInt64(footer + 8);
+
+  return success;
+}
+
+// Scan the binary chunk headers of a version 3 file (no usable index)
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::scanChunks() {
+
+  _chunks.clear();
+
+  qint64 size = _inpFile->size();
+  qint64 pos  = _dataStart;
+  while (pos + 4 <= size) {
+    char header[CHUNK_HEADER_SIZE];
+    _inpFile->seek(pos);
+    if (_inpFile->read(header, 4) != 4) {
+      break;
+    }
+    if      (memcmp(header, CHUNK_MAGIC, 4) == 0) {
+      if (_inpFile->read(header + 4, CHUNK_HEADER_SIZE - 4) != CHUNK_HEADER_SIZE - 4) {
+        break;
+      }
+      t_chunk chunk;
+      getChunkInfo(header + 4, chunk);
+      chunk._offset = pos + CHUNK_HEADER_SIZE;
+      if (chunk._nBytes < 0 || chunk._offset + chunk._nBytes > size) {
+        break;
+      }
+      _chunks.push_back(chunk);
+      pos = chunk._offset + chunk._nBytes;
+    }
+    else if (memcmp(header, INDEX_MAGIC, 4) == 0) {
+      if (_inpFile->read(header + 4, INDEX_HEADER_SIZE - 4) != INDEX_HEADER_SIZE - 4) {
+        break;
+      }
+      pos += INDEX_HEADER_SIZE + qint64(getInt32(header + 4)) * INDEX_ENTRY_SIZE;
+    }
+    else {
+      break;
+    }
+  }
+  _scanEnd = qMin(pos, size);
+}
+
+// Scan the text chunk headers of a version 1 file
+////////////////////////////////////////////////////////////////////////////
+void bncRawFile::scanChunksV1() {
+
+  _chunks.clear();
+
+  qint64 size = _inpFile->size();
+  _inpFile->seek(_dataStart);
+  while (!_inpFile->atEnd()) {
+    QByteArray line = _inpFile->readLine().trimmed();
+    if (line.isEmpty() || line.indexOf("Version of BNC raw file") != -1) {
+      continue;
+    }
+    QList<QByteArray> lst = line.split(' ');
+    if (lst.size() < 4) {
+      continue;
+    }
+    t_chunk chunk;
+    chunk._epoch  = QDateTime::fromString(QString(lst[0]), Qt::ISODate);
+    chunk._staID  = lst[1];
+    chunk._format = lst[2];
+    chunk._nBytes = lst[3].toInt();
+    chunk._offset = _inpFile->pos();
+    if (chunk._nBytes <= 0 || chunk._offset + chunk._nBytes > size) {
+      break;
+    }
+    _chunks.push_back(chunk);
+    _inpFile->seek(chunk._offset + chunk._nBytes);
+  }
+  _inpFile->seek(_dataStart);
+}
+
+// Memory-map the input file and build the index of all chunks
+////////////////////////////////////////////////////////////////////////////
+t_irc bncRawFile::mapFile() {
+
+  if (!_inpFile || !_inpFile->isOpen()) {
+    return failure;
+  }
+
+  // Private mapping, the decoders get writable buffers without a copy
+  // -----------------------------------------------------------------
+  if (!_mapped) {
+    _mapped = _inpFile->map(0, _inpFile->size(), QFileDevice::MapPrivateOption);
+    if (!_mapped) {
+      return failure;
+    }
+  }
+
+  return buildIndex();
+}
+
+// Convert a raw file (any version) into the current version
+////////////////////////////////////////////////////////////////////////////
+t_irc bncRawFile::convert(const QByteArray& inpFileName, const QByteArray& outFileName) {
+
+  bncRawFile conv(inpFileName, "", input);
+  if (!conv._inpFile->isOpen()) {
+    return failure;
+  }
+  if (conv.buildIndex() != success) {
+    return failure;
+  }
+
+  // IDs of old files may be too long for the current version
+  // --------------------------------------------------------
+  for (int ii = 0; ii < conv._chunks.size(); ii++) {
+    const t_chunk& chunk = conv._chunks[ii];
+    if (!validIDs(chunk._staID, chunk._format)) {
+      BNC_CORE->slotMessage("bncRawFile: " + chunk._staID + " " + chunk._format
+                            + ": ID longer than " + QByteArray::number(ID_SIZE - 1)
+                            + " characters, cannot convert", true);
+      return failure;
+    }
+  }
+
+  QString outName(outFileName); expandEnvVar(outName);
+  conv.openOutput(outName, false);
+  if (!conv._outFile->isOpen()) {
+    return failure;
+  }
+
+  for (int ii = 0; ii < conv._chunks.size(); ii++) {
+    const t_chunk& chunk = conv._chunks[ii];
+    conv._inpFile->seek(chunk._offset);
+    conv.writeChunk(chunk._epoch, conv._inpFile->read(chunk._nBytes),
+                    chunk._staID, chunk._format);
+  }
+  conv.closeOutput();
+
+  return success;
+}
@@ -27,30 +27,77 @@
 
 #include <QFile>
 #include <QTextStream>
+#include <QVector>
+#include <QSet>
+#include <QDateTime>
 
 #include "bnccaster.h"
+#include "bncconst.h"
 
 class bncRawFile {
  public:
 
   enum inpOutFlag {input, output};
 
+  class t_chunk {
+   public:
+    QDateTime  _epoch;
+    QByteArray _staID;
+    QByteArray _format;
+    qint64     _offset;
+    int        _nBytes;
+  };
+
   bncRawFile(const QByteArray& fileName, const QByteArray& staID,
              inpOutFlag ioflg);
 
   ~bncRawFile();  
   QByteArray format() const {return _format;}
   QByteArray staID() const {return _staID;}
+  int        version() const {return _version;}
   QByteArray readChunk();
   void writeRawData(const QByteArray& data, const QByteArray& staID,
                     const QByteArray& format);
+  t_irc mapFile();
+  const QVector<t_chunk>& chunks() const {return _chunks;}
+  char* chunkData(const t_chunk& chunk) const {
+    return reinterpret_cast<char*>(_mapped) + chunk._offset;
+  }
+  static t_irc convert(const QByteArray& inpFileName, const QByteArray& outFileName);
+
  private:
-  QString    _fileName;
-  QString    _currentFileName;
-  QByteArray _format;
-  QByteArray _staID;
-  QFile*     _inpFile;
-  QFile*     _outFile;
-  int        _version;
+  void  openOutput(const QString& fileName, bool append);
+  void  closeOutput();
+  void  writeChunk(const QDateTime& epoch, const QByteArray& data,
+                   const QByteArray& staID, const QByteArray& format);
+  void  appendIndexEntry(qint64 offset, const QDateTime& epoch, int nBytes,
+                         const QByteArray& staID, const QByteArray& format);
+  void  writeIndexBlock();
+  bool  selected(const t_chunk& chunk) const;
+  t_irc buildIndex();
+  t_irc readIndex();
+  void  scanChunks();
+  void  scanChunksV1();
+
+  QString          _fileName;
+  QString          _currentFileName;
+  QByteArray       _format;
+  QByteArray       _staID;
+  QFile*           _inpFile;
+  QFile*           _outFile;
+  int              _version;
+  int              _outVersion;
+  uchar*           _mapped;
+  QVector<t_chunk> _chunks;
+  bool             _indexRead;
+  int              _iChunk;
+  qint64           _dataStart;
+  qint64           _scanEnd;
+  QDateTime        _startTime;
+  QSet<QByteArray> _staFilter;
+  int              _nChunksOut;
+  qint64           _lastIndexOffset;
+  QByteArray       _pendingIndex;
+  QSet<QByteArray> _rejectedIDs;
 };
 #endif
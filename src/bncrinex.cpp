@@ -444,7 +444,7 @@ void bncRinex::writeHeader(const QByteArray& format, const bncTime& firstObsTime
 
 // Stores Observation into Internal Array
 ////////////////////////////////////////////////////////////////////////////
-void bncRinex::deepCopy(t_satObs obs) {
+void bncRinex::deepCopy(const t_satObs& obs) {
   _obs.push_back(obs);
 }
 
@@ -457,7 +457,7 @@ void bncRinex::dumpEpoch(const QByteArray& format, const bncTime& maxTime) {
   QList<t_satObs> obsList;
   QMutableListIterator<t_satObs> mIt(_obs);
   while (mIt.hasNext()) {
-    t_satObs obs = mIt.next();
+    const t_satObs& obs = mIt.next();
     if (obs._time < maxTime) {
       obsList.push_back(obs);
       mIt.remove();
@@ -512,7 +512,7 @@ void bncRinex::dumpEpoch(const QByteArray& format, const bncTime& maxTime) {
     }
 
     for (unsigned ii = 0; ii < satObs._obs.size(); ii++) {
-      const t_frqObs* frqObs = satObs._obs[ii];
+      const t_frqObs* frqObs = &satObs._obs[ii];
       if (frqObs->_codeValid) {
         QString type = 'C' + QString(frqObs->_rnxType2ch.c_str());
         t_rnxObsFile::t_rnxObs rnxObs;
@@ -579,36 +579,41 @@ void bncRinex::closeFile() {
 // One Line in ASCII (Internal) Format
 ////////////////////////////////////////////////////////////////////////////
 string bncRinex::asciiSatLine(const t_satObs& obs) {
-
   ostringstream str;
+  asciiSatLine(str, obs);
+  return str.str();
+}
+
+// Append the satellite line to a stream (no line feed)
+////////////////////////////////////////////////////////////////////////////
+void bncRinex::asciiSatLine(ostream& str, const t_satObs& obs) {
+
   str.setf(ios::showpoint | ios::fixed);
 
   str << obs._prn.toString();
 
   for (unsigned ii = 0; ii < obs._obs.size(); ii++) {
-    const t_frqObs* frqObs = obs._obs[ii];
+    const t_frqObs* frqObs = &obs._obs[ii];
     if (frqObs->_codeValid) {
       str << ' '
-          << left  << setw(3)  << "C" + frqObs->_rnxType2ch << ' '
+          << left  << 'C' << setw(2) << frqObs->_rnxType2ch.c_str() << ' '
           << right << setw(14) << setprecision(3) << frqObs->_code;
     }
     if (frqObs->_phaseValid) {
       str << ' '
-          << left  << setw(3) << "L" + frqObs->_rnxType2ch << ' '
+          << left  << 'L' << setw(2) << frqObs->_rnxType2ch.c_str() << ' '
           << right << setw(14) << setprecision(3) << frqObs->_phase << ' '
           << right << setw(4)                     << frqObs->_slipCounter;
     }
     if (frqObs->_dopplerValid) {
       str << ' '
-          << left  << setw(3) << "D" + frqObs->_rnxType2ch << ' '
+          << left  << 'D' << setw(2) << frqObs->_rnxType2ch.c_str() << ' '
           << right << setw(14) << setprecision(3) << frqObs->_doppler;
     }
     if (frqObs->_snrValid) {
       str << ' '
-          << left  << setw(3) << "S" + frqObs->_rnxType2ch << ' '
+          << left  << 'S' << setw(2) << frqObs->_rnxType2ch.c_str() << ' '
           << right << setw(8) << setprecision(3) << frqObs->_snr;
     }
   }
-
-  return str.str();
 }
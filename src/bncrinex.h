@@ -40,7 +40,7 @@ class bncRinex {
    ~bncRinex();
 
    int  samplingRate() const {return _samplingRate;}
-   void deepCopy(t_satObs obs);
+   void deepCopy(const t_satObs& obs);
    void dumpEpoch(const QByteArray& format, const bncTime& maxTime);
    void setReconnectFlag(bool flag){_reconnectFlag = flag;}
 
@@ -49,6 +49,7 @@ class bncRinex {
                                bool rnxV3filenames,
                                QDateTime* nextEpoch = 0);
    static std::string asciiSatLine(const t_satObs& obs);
+   static void asciiSatLine(std::ostream& str, const t_satObs& obs);
 
  private:
    void resolveFileName(const QDateTime& datTim);
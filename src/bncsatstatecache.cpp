@@ -0,0 +1,245 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      bncSatStateCache
+ *
+ * Purpose:    Shared satellite orbit/clock states for all PPP clients,
+ *             the combination and the RINEX analysis
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include <cmath>
+#include <cstring>
+
+#include "bncsatstatecache.h"
+#include "ephemeris.h"
+#include "satObs.h"
+
+using namespace NEWMAT;
+
+// Nodes kept per entry, entries unused for longer than MAXAGE seconds
+// are removed
+////////////////////////////////////////////////////////////////////////////
+static const int    MAXNODES = 16;
+static const qint64 MAXAGE   = 600;
+
+// Hash of the cache key
+////////////////////////////////////////////////////////////////////////////
+uint qHash(const bncSatStateCache::t_key& key, uint seed) {
+  return qHashBits(key._val, sizeof(key._val), seed);
+}
+
+// Cache key: satellite, ephemeris and (optionally) the applied corrections
+////////////////////////////////////////////////////////////////////////////
+bncSatStateCache::t_key::t_key(const t_eph* eph, bool useCorr) {
+  memset(_val, 0, sizeof(_val));
+
+  const t_prn& prn = eph->prn();
+  _val[0] = prn.system();
+  _val[1] = prn.number();
+  _val[2] = prn.flags();
+  _val[3] = eph->type();
+  _val[4] = eph->IOD();
+  _val[5] = eph->TOC().mjd() * 86400.0 + eph->TOC().daysec();
+
+  if (useCorr) {
+    const t_orbCorr* orbCorr = eph->orbCorr();
+    const t_clkCorr* clkCorr = eph->clkCorr();
+    _val[6]  = 1.0;
+    _val[7]  = orbCorr->_time.mjd() * 86400.0 + orbCorr->_time.daysec();
+    _val[8]  = orbCorr->_updateInt;
+    _val[9]  = orbCorr->_xr(1);
+    _val[10] = orbCorr->_xr(2);
+    _val[11] = orbCorr->_xr(3);
+    _val[12] = orbCorr->_dotXr(1);
+    _val[13] = orbCorr->_dotXr(2);
+    _val[14] = orbCorr->_dotXr(3);
+    _val[15] = clkCorr->_time.mjd() * 86400.0 + clkCorr->_time.daysec();
+    _val[16] = clkCorr->_updateInt;
+    _val[17] = clkCorr->_dClk;
+    _val[18] = clkCorr->_dotDClk;
+    _val[19] = clkCorr->_dotDotDClk;
+  }
+}
+
+// Singleton
+////////////////////////////////////////////////////////////////////////////
+bncSatStateCache* bncSatStateCache::instance() {
+  static bncSatStateCache _satStateCache;
+  return &_satStateCache;
+}
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+bncSatStateCache::bncSatStateCache() : _hits(0), _misses(0) {
+  _lastCleanup = 0;
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+bncSatStateCache::~bncSatStateCache() {
+}
+
+// Fraction of node requests served from the cache
+////////////////////////////////////////////////////////////////////////////
+double bncSatStateCache::hitRate() const {
+  qint64 nHits = _hits.load();
+  qint64 nAll  = nHits + _misses.load();
+  return nAll ? double(nHits) / nAll : 0.0;
+}
+
+// State at an integer GPS second (from the cache or evaluated)
+////////////////////////////////////////////////////////////////////////////
+t_irc bncSatStateCache::node(const t_eph* eph, const t_key& key, qint64 sec,
+                             bool useCorr, t_node& nd) {
+  {
+    QMutexLocker locker(&_mutex);
+    QHash<t_key, t_entry>::iterator it = _entries.find(key);
+    if (it != _entries.end()) {
+      QMap<qint64, t_node>::const_iterator itNode = it->_nodes.constFind(sec);
+      if (itNode != it->_nodes.constEnd()) {
+        nd = itNode.value();
+        if (it->_lastUsed < sec) {
+          it->_lastUsed = sec;
+        }
+        _hits.fetchAndAddRelaxed(1);
+        return success;
+      }
+    }
+  }
+
+  // Evaluate outside the lock
+  // -------------------------
+  _misses.fetchAndAddRelaxed(1);
+  ColumnVector xc(4);
+  ColumnVector vv(3);
+  bncTime tt(int(sec / 604800), double(sec % 604800));
+  if (eph->getCrd(tt, xc, vv, useCorr) != success) {
+    return failure;
+  }
+  for (int ii = 0; ii < 4; ii++) {
+    nd._xc[ii] = xc(ii+1);
+  }
+  for (int ii = 0; ii < 3; ii++) {
+    nd._vv[ii] = vv(ii+1);
+  }
+
+  QMutexLocker locker(&_mutex);
+
+  t_entry& entry = _entries[key];
+  entry._nodes[sec] = nd;
+  if (entry._nodes.size() > MAXNODES) {
+    entry._nodes.erase(entry._nodes.begin());
+  }
+  if (entry._lastUsed < sec) {
+    entry._lastUsed = sec;
+  }
+
+  // Remove entries of outdated ephemerides/corrections
+  // --------------------------------------------------
+  if (sec - _lastCleanup > MAXAGE) {
+    QMutableHashIterator<t_key, t_entry> itEntry(_entries);
+    while (itEntry.hasNext()) {
+      itEntry.next();
+      if (sec - itEntry.value()._lastUsed > MAXAGE) {
+        itEntry.remove();
+      }
+    }
+    _lastCleanup = sec;
+  }
+
+  return success;
+}
+
+// Satellite position, velocity and clock at arbitrary time
+////////////////////////////////////////////////////////////////////////////
+t_irc bncSatStateCache::getCrd(const t_eph* eph, const bncTime& tt,
+                               ColumnVector& xc, ColumnVector& vv, bool useCorr) {
+
+  if (eph->checkState() == t_eph::bad) {
+    return failure;
+  }
+  if (useCorr && !(eph->orbCorr() && eph->clkCorr())) {
+    return failure;
+  }
+
+  t_key  key(eph, useCorr);
+  double gpssec = tt.gpssec();
+  double secInt = floor(gpssec);
+  qint64 sec0   = qint64(tt.gpsw()) * 604800 + qint64(secInt);
+  double ss     = gpssec - secInt;
+
+  t_node nd0;
+  t_node nd1;
+  if (node(eph, key, sec0, useCorr, nd0) != success) {
+    return eph->getCrd(tt, xc, vv, useCorr);
+  }
+
+  xc.ReSize(4);
+  vv.ReSize(3);
+
+  if (ss == 0.0) {
+    for (int ii = 0; ii < 3; ii++) {
+      xc(ii+1) = nd0._xc[ii];
+      vv(ii+1) = nd0._vv[ii];
+    }
+    xc(4) = nd0._xc[3];
+    return success;
+  }
+
+  if (node(eph, key, sec0 + 1, useCorr, nd1) != success) {
+    return eph->getCrd(tt, xc, vv, useCorr);
+  }
+
+  // Cubic Hermite interpolation of the position (1 s node spacing)
+  // --------------------------------------------------------------
+  double s2  = ss * ss;
+  double s3  = s2 * ss;
+  double h00 =  2.0 * s3 - 3.0 * s2 + 1.0;
+  double h10 =        s3 - 2.0 * s2 + ss;
+  double h01 = -2.0 * s3 + 3.0 * s2;
+  double h11 =        s3 -       s2;
+  double d00 =  6.0 * s2 - 6.0 * ss;
+  double d10 =  3.0 * s2 - 4.0 * ss + 1.0;
+  double d01 = -6.0 * s2 + 6.0 * ss;
+  double d11 =  3.0 * s2 - 2.0 * ss;
+  for (int ii = 0; ii < 3; ii++) {
+    xc(ii+1) = h00 * nd0._xc[ii] + h10 * nd0._vv[ii] + h01 * nd1._xc[ii] + h11 * nd1._vv[ii];
+    vv(ii+1) = d00 * nd0._xc[ii] + d10 * nd0._vv[ii] + d01 * nd1._xc[ii] + d11 * nd1._vv[ii];
+  }
+
+  // Linear interpolation of the clock
+  // ---------------------------------
+  xc(4) = nd0._xc[3] + ss * (nd1._xc[3] - nd0._xc[3]);
+
+  return success;
+}
@@ -0,0 +1,91 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+#ifndef BNCSATSTATECACHE_H
+#define BNCSATSTATECACHE_H
+
+#include <cstring>
+#include <QtCore>
+#include <newmat/newmat.h>
+
+#include "bncconst.h"
+#include "bnctime.h"
+
+class t_eph;
+
+// Process-wide cache of satellite position, velocity and clock. States
+// are evaluated once per ephemeris, correction and integer GPS second and
+// interpolated (cubic Hermite position, linear clock) to arbitrary times.
+// Identical ephemerides/corrections held by different users share the
+// same entries.
+////////////////////////////////////////////////////////////////////////////
+class bncSatStateCache {
+ public:
+  static bncSatStateCache* instance();
+
+  t_irc getCrd(const t_eph* eph, const bncTime& tt, NEWMAT::ColumnVector& xc,
+               NEWMAT::ColumnVector& vv, bool useCorr);
+
+  qint64 hits()   const {return _hits.load();}
+  qint64 misses() const {return _misses.load();}
+  double hitRate() const;
+
+ private:
+  enum {NUMKEYVALUES = 20};
+
+  class t_key {
+   public:
+    t_key(const t_eph* eph, bool useCorr);
+    bool operator==(const t_key& key2) const {
+      return memcmp(_val, key2._val, sizeof(_val)) == 0;
+    }
+    double _val[NUMKEYVALUES];
+  };
+  friend uint qHash(const bncSatStateCache::t_key& key, uint seed);
+
+  class t_node {
+   public:
+    double _xc[4];
+    double _vv[3];
+  };
+
+  class t_entry {
+   public:
+    t_entry() {_lastUsed = 0;}
+    QMap<qint64, t_node> _nodes;
+    qint64               _lastUsed;
+  };
+
+  bncSatStateCache();
+  ~bncSatStateCache();
+  t_irc node(const t_eph* eph, const t_key& key, qint64 sec, bool useCorr, t_node& nd);
+
+  QMutex                 _mutex;
+  QHash<t_key, t_entry>  _entries;
+  qint64                 _lastCleanup;
+  QAtomicInteger<qint64> _hits;
+  QAtomicInteger<qint64> _misses;
+};
+
+#endif
@@ -84,6 +84,9 @@ void bncSettings::reRead() {
     setValue_p("onTheFlyInterval",    "1 day");
     setValue_p("autoStart",           "0");
     setValue_p("rawOutFile",          "");
+    setValue_p("rawReplayThreads",    "0");
+    setValue_p("rawReplayStart",      "");
+    setValue_p("rawReplayStations",   "");
     // RINEX Observations
     setValue_p("rnxPath",             "");
     setValue_p("rnxIntr",             "1 day");
@@ -144,10 +147,14 @@ void bncSettings::reRead() {
     setValue_p("corrPort",            "");
     // Feed Engine
     setValue_p("outPort",             "");
+    setValue_p("outFormat",           "ascii");
     setValue_p("outWait",             "5");
     setValue_p("outSampl",            "0");
     setValue_p("outFile",             "");
     setValue_p("outUPort",            "");
+    setValue_p("outUFormat",          "ascii");
+    setValue_p("outQueueSize",        "1024");
+    setValue_p("outQueueOverflow",    "drop");
     // Serial Output
     setValue_p("serialMountPoint",    "");
     setValue_p("serialPortName",      "");
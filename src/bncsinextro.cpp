@@ -32,16 +32,12 @@ bncSinexTro::bncSinexTro(const t_pppOptions* opt,
 
   _opt       = opt;
   (!sampl) ? _sampl = 1 : _sampl =  sampl;
-
-  _antex = 0;
 }
 
 // Destructor
 ////////////////////////////////////////////////////////////////////////////
 bncSinexTro::~bncSinexTro() {
   closeFile();
-  if (_antex)
-    delete _antex;
 }
 
 // Write Header
@@ -146,16 +142,19 @@ void bncSinexTro::writeHeader(const QDateTime& datTim) {
        << _opt->_antNameRover << " -----" << endl;
   _out << "-SITE/ANTENNA" << endl << endl;
 
+  QSharedPointer<const bncAntex> antex;
   if (!_opt->_antexFileName.empty()) {
-    _antex = new bncAntex(_opt->_antexFileName.c_str());
+    antex = bncAntex::shared(_opt->_antexFileName.c_str());
+  }
+  if (antex) {
     if (_opt->_LCsGPS.size()) {
       _out << "+SITE/GPS_PHASE_CENTER" << endl;
       _out << "*                           UP____ NORTH_ EAST__ UP____ NORTH_ EAST__" << endl;
       _out << "*DESCRIPTION_________ S/N__ L1->ARP(m)__________ L2->ARP(m)__________ AZ_EL____" << endl;
       _out << QString(" %1").arg(_opt->_antNameRover.c_str(), 20,QLatin1Char(' ')).toStdString()
            <<  " -----"
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::G1).toStdString()
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::G2).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::G1).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::G2).toStdString()
            <<  " ---------"
         << endl;
       _out << "-SITE/GPS_PHASE_CENTER" << endl << endl;
@@ -166,8 +165,8 @@ void bncSinexTro::writeHeader(const QDateTime& datTim) {
       _out << "*DESCRIPTION_________ S/N__ L1->ARP(m)__________ L2->ARP(m)__________ AZ_EL____" << endl;
       _out << QString(" %1").arg(_opt->_antNameRover.c_str(), 20,QLatin1Char(' ')).toStdString()
            <<  " -----"
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::R1).toStdString()
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::R2).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::R1).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::R2).toStdString()
            <<  " ---------"
         << endl;
       _out << "-SITE/GLONASS_PHASE_CENTER" << endl << endl;
@@ -178,8 +177,8 @@ void bncSinexTro::writeHeader(const QDateTime& datTim) {
       _out << "*DESCRIPTION_________ S/N__ L1->ARP(m)__________ L2->ARP(m)__________ AZ_EL____" << endl;
       _out << QString(" %1").arg(_opt->_antNameRover.c_str(), 20,QLatin1Char(' ')).toStdString()
            <<  " -----"
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::E1).toStdString()
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::E5).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::E1).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::E5).toStdString()
         << endl;
       _out << "-SITE/GALILEO_PHASE_CENTER" << endl << endl;
     }
@@ -189,13 +188,11 @@ void bncSinexTro::writeHeader(const QDateTime& datTim) {
       _out << "*DESCRIPTION_________ S/N__ L1->ARP(m)__________ L2->ARP(m)__________ AZ_EL____" << endl;
       _out << QString(" %1").arg(_opt->_antNameRover.c_str(), 20,QLatin1Char(' ')).toStdString()
            <<  " -----"
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::C2).toStdString()
-           << _antex->pcoSinexString(_opt->_antNameRover, t_frequency::C7).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::C2).toStdString()
+           << antex->pcoSinexString(_opt->_antNameRover, t_frequency::C7).toStdString()
         << endl;
       _out << "-SITE/BEIDOU_PHASE_CENTER" << endl << endl;
     }
-    delete _antex;
-    _antex = 0;
   }
 
   _out << "+SITE/ECCENTRICITY" << endl;
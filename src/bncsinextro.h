@@ -30,7 +30,6 @@ class bncSinexTro : public bncoutf {
   QString _roverName;
   int _sampl;
   const t_pppOptions*  _opt;
-  bncAntex* _antex;
   double _antPCO[t_frequency::max];
 };
 
@@ -25,6 +25,8 @@
 
 
 #include <iostream>
+#include <vector>
+#include <cmath>
 #include <ctime>
 #include <math.h>
 
@@ -38,7 +40,9 @@
 
 #include "bncutils.h"
 #include "bnccore.h"
+#include "bncgpstime.h"
 #include "Misc.h"
+#include "crc24q.h"
 
 using namespace std;
 using namespace NEWMAT;
@@ -198,18 +202,13 @@ QDateTime dateAndTimeFromGPSweek(int GPSWeek, double GPSWeeks) {
 ////////////////////////////////////////////////////////////////////////////
 void currentGPSWeeks(int& week, double& sec) {
 
-  QDateTime currDateTimeGPS;
-
-  if ( BNC_CORE->dateAndTimeGPSSet() ) {
-    currDateTimeGPS = BNC_CORE->dateAndTimeGPS();
-  }
-  else {
-    currDateTimeGPS = QDateTime::currentDateTime().toUTC();
-    QDate hlp       = currDateTimeGPS.date();
-    currDateTimeGPS = currDateTimeGPS.addSecs(gnumleap(hlp.year(),
-                                                     hlp.month(), hlp.day()));
+  if ( !BNC_CORE->dateAndTimeGPSSet() ) {
+    bncGpsTime::instance()->currentGPSWeeks(week, sec);
+    return;
   }
 
+  QDateTime currDateTimeGPS = BNC_CORE->dateAndTimeGPS();
+
   QDate currDateGPS = currDateTimeGPS.date();
   QTime currTimeGPS = currDateTimeGPS.time();
 
@@ -229,10 +228,7 @@ QDateTime currentDateAndTimeGPS() {
     return BNC_CORE->dateAndTimeGPS();
   }
   else {
-    int    GPSWeek;
-    double GPSWeeks;
-    currentGPSWeeks(GPSWeek, GPSWeeks);
-    return dateAndTimeFromGPSweek(GPSWeek, GPSWeeks);
+    return bncGpsTime::instance()->currentDateAndTime();
   }
 }
 
@@ -867,13 +863,123 @@ QString fortranFormat(double value, int width, int prec) {
   }
 }
 
+// Square-root covariance update, one observation after the other
 //
+// With QQ = L L' the array [1/sqrt(p)  h L; 0  L] is brought to lower
+// triangular form [sqrt(s)  0; k  L+] by Givens rotations, s = h QQ h' + 1/p,
+// k = QQ h' / sqrt(s) and L+ the factor of the updated covariance matrix.
+// f = h L is computed from the nonzero elements of h only and vanishes
+// beyond the last parameter observed, rotations are applied where f != 0.
+// The cost is O(nObs nPar^2) instead of O((nObs+nPar)^3) for kalmanDense,
+// which remains the fallback if the update breaks down numerically.
 //////////////////////////////////////////////////////////////////////////////
 void kalman(const Matrix& AA, const ColumnVector& ll, const DiagonalMatrix& PP,
             SymmetricMatrix& QQ, ColumnVector& xx) {
 
   Tracer tracer("kalman");
 
+  int nPar = AA.Ncols();
+  int nObs = AA.Nrows();
+  if (nPar == 0) {
+    return;
+  }
+
+  // Cholesky factor, stored column by column (lower part only)
+  // ----------------------------------------------------------
+  LowerTriangularMatrix LC = Cholesky(QQ);
+  vector<double> LL(nPar*nPar, 0.0);
+  for (int jj = 0; jj < nPar; jj++) {
+    for (int ii = jj; ii < nPar; ii++) {
+      LL[jj*nPar + ii] = LC(ii+1, jj+1);
+    }
+  }
+
+  vector<double> kk(nPar);
+  vector<double> ff(nPar);
+  vector<int>    idx;
+  ColumnVector   xNew = xx;
+
+  for (int iObs = 1; iObs <= nObs; iObs++) {
+    const double* hh = AA.Store() + (iObs-1)*nPar;
+
+    idx.clear();
+    for (int iPar = 0; iPar < nPar; iPar++) {
+      if (hh[iPar] != 0.0) {
+        idx.push_back(iPar);
+      }
+    }
+
+    double yy = ll(iObs);
+    for (unsigned ii = 0; ii < idx.size(); ii++) {
+      yy -= hh[idx[ii]] * xNew(idx[ii]+1);
+    }
+
+    // f = h L (only up to the last observed parameter)
+    // ------------------------------------------------
+    int jMax = idx.empty() ? -1 : idx.back();
+    for (int jj = 0; jj <= jMax; jj++) {
+      double fj = 0.0;
+      for (unsigned ii = 0; ii < idx.size(); ii++) {
+        if (idx[ii] >= jj) {
+          fj += hh[idx[ii]] * LL[jj*nPar + idx[ii]];
+        }
+      }
+      ff[jj] = fj;
+    }
+
+    // Rotate the observation column against the columns of L
+    // -------------------------------------------------------
+    double top = 1.0 / sqrt(PP(iObs,iObs));
+    for (int ii = 0; ii < nPar; ii++) {
+      kk[ii] = 0.0;
+    }
+    for (int jj = jMax; jj >= 0; jj--) {
+      if (ff[jj] == 0.0) {
+        continue;
+      }
+      double rr = sqrt(top*top + ff[jj]*ff[jj]);
+      double cc = top    / rr;
+      double ss = ff[jj] / rr;
+      double* Lj = &LL[jj*nPar];
+      for (int ii = jj; ii < nPar; ii++) {
+        double k0 = kk[ii];
+        kk[ii] =  cc * k0 + ss * Lj[ii];
+        Lj[ii] = -ss * k0 + cc * Lj[ii];
+      }
+      top = rr;
+    }
+
+    if (!(top > 0.0) || std::isinf(top) || std::isnan(yy)) {
+      kalmanDense(AA, ll, PP, QQ, xx);
+      return;
+    }
+
+    for (int ii = 0; ii < nPar; ii++) {
+      xNew(ii+1) += kk[ii] * yy / top;
+    }
+  }
+
+  // Updated covariance matrix QQ = L L'
+  // -----------------------------------
+  for (int aa = 0; aa < nPar; aa++) {
+    for (int bb = 0; bb <= aa; bb++) {
+      double sum = 0.0;
+      for (int jj = 0; jj <= bb; jj++) {
+        sum += LL[jj*nPar + aa] * LL[jj*nPar + bb];
+      }
+      QQ(aa+1, bb+1) = sum;
+    }
+  }
+  xx = xNew;
+}
+
+// Square-root update, QR decomposition of the full (nObs+nPar) array
+//////////////////////////////////////////////////////////////////////////////
+void kalmanDense(const Matrix& AA, const ColumnVector& ll, const DiagonalMatrix& PP,
+                 SymmetricMatrix& QQ, ColumnVector& xx) {
+
+  Tracer tracer("kalmanDense");
+
   int nPar = AA.Ncols();
   int nObs = AA.Nrows();
   UpperTriangularMatrix SS = Cholesky(QQ).t();
@@ -1026,17 +1132,6 @@ int indexFromAccuracy(double accuracy, t_eph::e_type type) {
 // Returns CRC24
 ////////////////////////////////////////////////////////////////////////////
 unsigned long CRC24(long size, const unsigned char *buf) {
-  unsigned long crc = 0;
-  int ii;
-  while (size--) {
-    crc ^= (*buf++) << (16);
-    for(ii = 0; ii < 8; ii++) {
-      crc <<= 1;
-      if (crc & 0x1000000) {
-        crc ^= 0x01864cfb;
-      }
-    }
-  }
-  return crc;
+  return crc24q(size, buf);
 }
 
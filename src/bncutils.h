@@ -131,6 +131,9 @@ QString      fortranFormat(double value, int width, int prec);
 void         kalman(const NEWMAT::Matrix& AA, const NEWMAT::ColumnVector& ll, const NEWMAT::DiagonalMatrix& PP,
                     NEWMAT::SymmetricMatrix& QQ, NEWMAT::ColumnVector& xx);
 
+void         kalmanDense(const NEWMAT::Matrix& AA, const NEWMAT::ColumnVector& ll, const NEWMAT::DiagonalMatrix& PP,
+                         NEWMAT::SymmetricMatrix& QQ, NEWMAT::ColumnVector& xx);
+
 double       djul(long j1, long m1, double tt);
 
 double       gpjd(double second, int nweek) ;
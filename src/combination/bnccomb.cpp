@@ -17,6 +17,7 @@
 #include <newmat/newmatio.h>
 #include <iomanip>
 #include <sstream>
+#include <QElapsedTimer>
 
 #include "bnccomb.h"
 #include "bnccore.h"
@@ -25,6 +26,7 @@
 #include "bncutils.h"
 #include "bncsp3.h"
 #include "bncantex.h"
+#include "bncsatstatecache.h"
 #include "t_prn.h"
 
 using namespace NEWMAT;
@@ -179,13 +181,20 @@ bncComb::bncComb() : _ephUser(true) {
 
   // Combination Method
   // ------------------
-  if (settings.value("cmbMethod").toString() == "Single-Epoch") {
+  if      (settings.value("cmbMethod").toString() == "Single-Epoch") {
     _method = singleEpoch;
   }
+  else if (settings.value("cmbMethod").toString() == "Sparse-Filter") {
+    _method = sparseFilter;
+  }
   else {
     _method = filter;
   }
 
+  // Report the processing time per epoch (always for Sparse-Filter)
+  // ---------------------------------------------------------------
+  _cmbTiming = (settings.value("cmbTiming").toInt() != 0 || _method == sparseFilter);
+
   // Use Glonass
   // -----------
   if ( Qt::CheckState(settings.value("cmbUseGlonass").toInt()) == Qt::Checked) {
@@ -197,7 +206,7 @@ bncComb::bncComb() : _ephUser(true) {
 
   // Initialize Parameters (model: Clk_Corr = AC_Offset + Sat_Offset + Clk)
   // ----------------------------------------------------------------------
-  if (_method == filter) {
+  if (_method == filter || _method == sparseFilter) {
     int nextPar = 0;
     QListIterator<cmbAC*> it(_ACs);
     while (it.hasNext()) {
@@ -230,24 +239,58 @@ bncComb::bncComb() : _ephUser(true) {
 
     // Initialize Variance-Covariance Matrix
     // -------------------------------------
-    _QQ.ReSize(_params.size());
-    _QQ = 0.0;
-    for (int iPar = 1; iPar <= _params.size(); iPar++) {
-      cmbParam* pp = _params[iPar-1];
-      _QQ(iPar,iPar) = pp->sig0 * pp->sig0;
+    if (_method == filter) {
+      _QQ.ReSize(_params.size());
+      _QQ = 0.0;
+      for (int iPar = 1; iPar <= _params.size(); iPar++) {
+        cmbParam* pp = _params[iPar-1];
+        _QQ(iPar,iPar) = pp->sig0 * pp->sig0;
+      }
+    }
+
+    // One Block of Satellite Offsets per Satellite (Sparse Filter)
+    // ------------------------------------------------------------
+    else {
+      for (int iPar = 1; iPar <= _params.size(); iPar++) {
+        cmbParam* pClk = _params[iPar-1];
+        if (pClk->type != cmbParam::clkSat) {
+          continue;
+        }
+        cmbSatBlock* blk = new cmbSatBlock();
+        blk->prn  = pClk->prn;
+        blk->iClk = pClk->index;
+        QListIterator<cmbAC*> itAC(_ACs);
+        while (itAC.hasNext()) {
+          cmbAC* AC = itAC.next();
+          for (int jPar = 1; jPar <= _params.size(); jPar++) {
+            cmbParam* pOff = _params[jPar-1];
+            if (pOff->type == cmbParam::offACSat &&
+                pOff->AC   == AC->name && pOff->prn == pClk->prn) {
+              blk->iOff.push_back(pOff->index);
+              break;
+            }
+          }
+        }
+        blk->QQ.ReSize(blk->iOff.size());
+        blk->QQ = 0.0;
+        for (int ii = 1; ii <= blk->iOff.size(); ii++) {
+          blk->QQ(ii,ii) = sig0_offACSat * sig0_offACSat;
+        }
+        _satBlockIndex[blk->prn] = _satBlocks.size();
+        _satBlocks.push_back(blk);
+      }
+      _sigmas.ReSize(_params.size());
+      _sigmas = 0.0;
     }
   }
 
   // ANTEX File
   // ----------
-  _antex = 0;
   QString antexFileName = settings.value("uploadAntexFile").toString();
   if (!antexFileName.isEmpty()) {
-    _antex = new bncAntex();
-    if (_antex->readFile(antexFileName) != success) {
+    _antex = bncAntex::shared(antexFileName);
+    if (!_antex) {
       emit newMessage("wrong ANTEX file", true);
-      delete _antex;
-      _antex = 0;
     }
   }
 
@@ -267,10 +310,12 @@ bncComb::~bncComb() {
     delete icAC.next();
   }
   delete _rtnetDecoder;
-  delete _antex;
   for (int iPar = 1; iPar <= _params.size(); iPar++) {
     delete _params[iPar-1];
   }
+  for (int iBlk = 0; iBlk < _satBlocks.size(); iBlk++) {
+    delete _satBlocks[iBlk];
+  }
   QListIterator<bncTime> itTime(_buffer.keys());
   while (itTime.hasNext()) {
     bncTime epoTime = itTime.next();
@@ -538,15 +583,28 @@ void bncComb::processEpoch() {
 
   // Perform the actual Combination using selected Method
   // ----------------------------------------------------
+  QElapsedTimer timer;
+  timer.start();
+
   t_irc irc;
   ColumnVector dx;
-  if (_method == filter) {
+  if      (_method == filter) {
     irc = processEpoch_filter(out, resCorr, dx);
   }
+  else if (_method == sparseFilter) {
+    irc = processEpoch_sparse(out, resCorr, dx);
+  }
   else {
     irc = processEpoch_singleEpoch(out, resCorr, dx);
   }
 
+  if (_cmbTiming) {
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(3);
+    out << _resTime.datestr().c_str() << " " << _resTime.timestr().c_str()
+        << " Processing Time " << timer.nsecsElapsed() / 1.e6 << " ms" << endl;
+  }
+
   // Update Parameter Values, Print Results
   // --------------------------------------
   if (irc == success) {
@@ -563,8 +621,10 @@ void bncComb::processEpoch() {
       out.setRealNumberNotation(QTextStream::FixedNotation);
       out.setFieldWidth(8);
       out.setRealNumberPrecision(4);
+      double sig = (_method == sparseFilter) ? _sigmas(pp->index)
+                                             : sqrt(_QQ(pp->index,pp->index));
       out << pp->toString() << " "
-          << pp->xx << " +- " << sqrt(_QQ(pp->index,pp->index)) << endl;
+          << pp->xx << " +- " << sig << endl;
       out.setFieldWidth(0);
     }
     printResults(out, resCorr);
@@ -668,6 +728,306 @@ t_irc bncComb::processEpoch_filter(QTextStream& out,
   return success;
 }
 
+// Process Epoch - Sparse Filter Method
+//
+// Satellite clocks and AC offsets are estimated for the current epoch only
+// and eliminated from the normal equations: per satellite block of the
+// satellite offsets and the clock, then for the (few) AC offsets. The
+// constraint on the sum of the clocks enters as rank-one modification.
+// Satellite offsets are kept in one covariance block per satellite, the
+// cost grows linearly with the number of satellites.
+////////////////////////////////////////////////////////////////////////////
+t_irc bncComb::processEpoch_sparse(QTextStream& out,
+                                   QMap<QString, cmbCorr*>& resCorr,
+                                   ColumnVector& dx) {
+
+  const double Ph   = 1.e6;
+  const double Pobs = 1.0 / (sigObs * sigObs);
+
+  int nAC  = _ACs.size();
+  int nB   = nAC + 1;    // satellite offsets of all ACs and satellite clock
+  int nPar = _params.size();
+
+  // Prediction Step
+  // ---------------
+  for (int iPar = 1; iPar <= nPar; iPar++) {
+    cmbParam* pp = _params[iPar-1];
+    if (pp->epoSpec) {
+      pp->xx = 0.0;
+    }
+  }
+  for (int iBlk = 0; iBlk < _satBlocks.size(); iBlk++) {
+    cmbSatBlock* blk = _satBlocks[iBlk];
+    for (int ii = 1; ii <= nAC; ii++) {
+      blk->QQ(ii,ii) += sigP_offACSat * sigP_offACSat;
+    }
+  }
+
+  // AC offsets (border parameters)
+  // ------------------------------
+  QMap<QString, int> offACgps;
+  QMap<QString, int> offACglo;
+  for (int iPar = 1; iPar <= nPar; iPar++) {
+    cmbParam* pp = _params[iPar-1];
+    if      (pp->type == cmbParam::offACgps) {
+      offACgps[pp->AC] = pp->index;
+    }
+    else if (pp->type == cmbParam::offACglo) {
+      offACglo[pp->AC] = pp->index;
+    }
+  }
+
+  // Check Satellite Positions for Outliers
+  // --------------------------------------
+  if (checkOrbits(out) != success) {
+    return failure;
+  }
+
+  // Update and outlier detection loop
+  // ---------------------------------
+  QVector<SymmetricMatrix> QQ_sav(_satBlocks.size());
+  for (int iBlk = 0; iBlk < _satBlocks.size(); iBlk++) {
+    QQ_sav[iBlk] = _satBlocks[iBlk]->QQ;
+  }
+
+  while (true) {
+
+    int nObs = corrs().size();
+    if (nObs == 0) {
+      return failure;
+    }
+
+    // Observations: AC, satellite block, AC offset, observed-computed
+    // ---------------------------------------------------------------
+    QVector<int>    obsAC(nObs);
+    QVector<int>    obsBlk(nObs);
+    QVector<int>    obsBor(nObs);
+    QVector<double> obsLL(nObs);
+    QVector<int>    blocks;    // satellite blocks observed in this epoch
+    QMap<int, int>  blkPos;    // satellite block -> position in blocks
+    QVector<int>    border;    // indices of the AC offsets observed
+    QMap<int, int>  borPos;    // AC offset index -> position in border
+
+    for (int iObs = 0; iObs < nObs; iObs++) {
+      cmbCorr* corr = corrs()[iObs];
+      QString  prn  = corr->_prn;
+
+      if (corr->_acName == _masterOrbitAC && resCorr.find(prn) == resCorr.end()) {
+        resCorr[prn] = new cmbCorr(*corr);
+      }
+
+      int iAC = 0;
+      while (_ACs[iAC]->name != corr->_acName) {
+        ++iAC;
+      }
+      int iBlk = _satBlockIndex.value(prn, -1);
+      int iBor = (prn[0] == 'G') ? offACgps.value(corr->_acName, 0)
+                                 : offACglo.value(corr->_acName, 0);
+      if (iBlk < 0 || iBor == 0) {
+        return failure;
+      }
+
+      if (!blkPos.contains(iBlk)) {
+        blkPos[iBlk] = blocks.size();
+        blocks.push_back(iBlk);
+      }
+      if (!borPos.contains(iBor)) {
+        borPos[iBor] = border.size();
+        border.push_back(iBor);
+      }
+
+      obsAC[iObs]  = iAC;
+      obsBlk[iObs] = blkPos[iBlk];
+      obsBor[iObs] = borPos[iBor];
+      obsLL[iObs]  = corr->_clkCorr._dClk * t_CST::c
+                   - _params[_satBlocks[iBlk]->iOff[iAC]-1]->xx;
+    }
+
+    int nBlk = blocks.size();
+    int nBor = border.size();
+
+    // Normal equations: one block per satellite, AC offsets as border
+    // ---------------------------------------------------------------
+    QVector<SymmetricMatrix> NN(nBlk);
+    QVector<Matrix>          EE(nBlk);
+    QVector<ColumnVector>    rr(nBlk);
+    SymmetricMatrix MM(nBor); MM = 0.0;
+    ColumnVector    ro(nBor); ro = 0.0;
+    for (int iBor = 1; iBor <= nBor; iBor++) {
+      MM(iBor,iBor) = 1.0 / (sig0_offAC * sig0_offAC);
+    }
+    try {
+      for (int kk = 0; kk < nBlk; kk++) {
+        NN[kk].ReSize(nB); NN[kk] = 0.0;
+        NN[kk].SymSubMatrix(1, nAC) = _satBlocks[blocks[kk]]->QQ.i();
+        NN[kk](nB,nB) = 1.0 / (sig0_clkSat * sig0_clkSat);
+        EE[kk].ReSize(nB, nBor); EE[kk] = 0.0;
+        rr[kk].ReSize(nB);       rr[kk] = 0.0;
+      }
+    }
+    catch (Exception& exc) {
+      out << exc.what() << endl;
+      return failure;
+    }
+
+    QVector< QVector<int> > obsACs(nBlk);
+    for (int iObs = 0; iObs < nObs; iObs++) {
+      int kk = obsBlk[iObs];
+      int ia = obsAC[iObs] + 1;
+      int io = obsBor[iObs] + 1;
+      NN[kk](ia,ia) += Pobs;
+      NN[kk](nB,ia) += Pobs;
+      NN[kk](nB,nB) += Pobs;
+      EE[kk](ia,io) += Pobs;
+      EE[kk](nB,io) += Pobs;
+      MM(io,io)     += Pobs;
+      rr[kk](ia)    += Pobs * obsLL[iObs];
+      rr[kk](nB)    += Pobs * obsLL[iObs];
+      ro(io)        += Pobs * obsLL[iObs];
+      obsACs[kk].push_back(ia);
+    }
+
+    // Regularization: satellite offsets of each GPS satellite sum up to zero
+    // ----------------------------------------------------------------------
+    for (int kk = 0; kk < nBlk; kk++) {
+      if (_satBlocks[blocks[kk]]->prn[0] != 'G') {
+        continue;
+      }
+      const QVector<int>& acs = obsACs[kk];
+      for (int i1 = 0; i1 < acs.size(); i1++) {
+        for (int i2 = 0; i2 <= i1; i2++) {
+          NN[kk](acs[i1],acs[i2]) += Ph;
+        }
+      }
+    }
+
+    // Eliminate the satellite blocks
+    // ------------------------------
+    QVector<SymmetricMatrix> NNi(nBlk);
+    QVector<Matrix>          NiE(nBlk);
+    SymmetricMatrix SS = MM;
+    ColumnVector    so = ro;
+    ColumnVector    su(nBor); su = 0.0;
+    SymmetricMatrix SSi;
+    try {
+      for (int kk = 0; kk < nBlk; kk++) {
+        NNi[kk] = NN[kk].i();
+        NiE[kk] = NNi[kk] * EE[kk];
+        SymmetricMatrix hlp; hlp << EE[kk].t() * NiE[kk];
+        SS -= hlp;
+        so -= NiE[kk].t() * rr[kk];
+        su -= NiE[kk].Row(nB).t();
+      }
+      SSi = SS.i();
+    }
+    catch (Exception& exc) {
+      out << exc.what() << endl;
+      return failure;
+    }
+
+    // Solve, regularization of the satellite clocks (rank-one update)
+    // ---------------------------------------------------------------
+    ColumnVector zo = SSi * so;
+    ColumnVector yo = SSi * su;
+    QVector<ColumnVector> zs(nBlk);
+    QVector<ColumnVector> ys(nBlk);
+    double uz = 0.0;
+    double uy = 0.0;
+    for (int kk = 0; kk < nBlk; kk++) {
+      ColumnVector uu(nB); uu = 0.0; uu(nB) = 1.0;
+      zs[kk] = NNi[kk] * (rr[kk] - EE[kk] * zo);
+      ys[kk] = NNi[kk] * (uu     - EE[kk] * yo);
+      uz += zs[kk](nB);
+      uy += ys[kk](nB);
+    }
+    double fac = Ph / (1.0 + Ph * uy);
+
+    dx.ReSize(nPar); dx = 0.0;
+    for (int io = 1; io <= nBor; io++) {
+      dx(border[io-1]) = zo(io) - fac * uz * yo(io);
+    }
+    for (int kk = 0; kk < nBlk; kk++) {
+      const cmbSatBlock* blk = _satBlocks[blocks[kk]];
+      for (int ia = 1; ia <= nAC; ia++) {
+        dx(blk->iOff[ia-1]) = zs[kk](ia) - fac * uz * ys[kk](ia);
+      }
+      dx(blk->iClk) = zs[kk](nB) - fac * uz * ys[kk](nB);
+    }
+
+    // Residuals
+    // ---------
+    ColumnVector vv(nObs);
+    for (int iObs = 0; iObs < nObs; iObs++) {
+      const cmbSatBlock* blk = _satBlocks[blocks[obsBlk[iObs]]];
+      vv(iObs+1) = obsLL[iObs] - dx(border[obsBor[iObs]])
+                 - dx(blk->iOff[obsAC[iObs]]) - dx(blk->iClk);
+    }
+
+    int     maxResIndex;
+    double  maxRes = vv.MaximumAbsoluteValue1(maxResIndex);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(3);
+    out << _resTime.datestr().c_str() << " " << _resTime.timestr().c_str()
+        << " Maximum Residuum " << maxRes << ' '
+        << corrs()[maxResIndex-1]->_acName << ' ' << corrs()[maxResIndex-1]->_prn.mid(0,3);
+
+    if (maxRes > _MAXRES) {
+      int iAC = obsAC[maxResIndex-1] + 1;
+      SymmetricMatrix& QQ = QQ_sav[blocks[obsBlk[maxResIndex-1]]];
+      QQ.Row(iAC)    = 0.0;
+      QQ.Column(iAC) = 0.0;
+      QQ(iAC,iAC)    = sig0_offACSat * sig0_offACSat;
+      for (int iBlk = 0; iBlk < _satBlocks.size(); iBlk++) {
+        _satBlocks[iBlk]->QQ = QQ_sav[iBlk];
+      }
+
+      out << "  Outlier" << endl;
+      delete corrs()[maxResIndex-1];
+      corrs().remove(maxResIndex-1);
+    }
+    else {
+      out << "  OK" << endl;
+
+      // Covariance matrices of the observed satellite blocks, sigmas
+      // ------------------------------------------------------------
+      for (int iPar = 1; iPar <= nPar; iPar++) {
+        _sigmas(iPar) = _params[iPar-1]->sig0;
+      }
+      for (int io = 1; io <= nBor; io++) {
+        _sigmas(border[io-1]) = sqrt(SSi(io,io) - fac * yo(io) * yo(io));
+      }
+      for (int kk = 0; kk < nBlk; kk++) {
+        cmbSatBlock* blk = _satBlocks[blocks[kk]];
+        SymmetricMatrix CC; CC << NNi[kk] + NiE[kk] * SSi * NiE[kk].t()
+                                  - fac * ys[kk] * ys[kk].t();
+        blk->QQ = CC.SymSubMatrix(1, nAC);
+        _sigmas(blk->iClk) = sqrt(CC(nB,nB));
+      }
+      for (int iBlk = 0; iBlk < _satBlocks.size(); iBlk++) {
+        const cmbSatBlock* blk = _satBlocks[iBlk];
+        for (int ia = 1; ia <= nAC; ia++) {
+          _sigmas(blk->iOff[ia-1]) = sqrt(blk->QQ(ia,ia));
+        }
+      }
+
+      out.setRealNumberNotation(QTextStream::FixedNotation);
+      out.setRealNumberPrecision(4);
+      for (int ii = 0; ii < corrs().size(); ii++) {
+        const cmbCorr* corr = corrs()[ii];
+        out << _resTime.datestr().c_str() << ' '
+            << _resTime.timestr().c_str() << " "
+            << corr->_acName << ' ' << corr->_prn.mid(0,3);
+        out.setFieldWidth(10);
+        out <<  " res = " << vv(ii+1) << endl;
+        out.setFieldWidth(0);
+      }
+      break;
+    }
+  }
+
+  return success;
+}
+
 // Print results
 ////////////////////////////////////////////////////////////////////////////
 void bncComb::printResults(QTextStream& out,
@@ -681,7 +1041,7 @@ void bncComb::printResults(QTextStream& out,
     if (eph) {
       ColumnVector xc(4);
       ColumnVector vv(3);
-      eph->getCrd(_resTime, xc, vv, false);
+      bncSatStateCache::instance()->getCrd(eph, _resTime, xc, vv, false);
 
       out << _resTime.datestr().c_str() << " "
           << _resTime.timestr().c_str() << " ";
@@ -1218,7 +1578,20 @@ void bncComb::slotProviderIDChanged(QString mountPoint) {
 
   // Reset Satellite Offsets
   // -----------------------
-  if (_method == filter) {
+  if (_method == sparseFilter) {
+    int iAC = 0;
+    while (iAC < _ACs.size() && _ACs[iAC]->name != acName) {
+      ++iAC;
+    }
+    for (int iBlk = 0; iAC < _ACs.size() && iBlk < _satBlocks.size(); iBlk++) {
+      cmbSatBlock* blk = _satBlocks[iBlk];
+      _params[blk->iOff[iAC]-1]->xx = 0.0;
+      blk->QQ.Row(iAC+1)    = 0.0;
+      blk->QQ.Column(iAC+1) = 0.0;
+      blk->QQ(iAC+1,iAC+1)  = sig0_offACSat * sig0_offACSat;
+    }
+  }
+  else if (_method == filter) {
     for (int iPar = 1; iPar <= _params.size(); iPar++) {
       cmbParam* pp = _params[iPar-1];
       if (pp->AC == acName && pp->type == cmbParam::offACSat) {
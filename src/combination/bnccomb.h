@@ -30,7 +30,7 @@ class bncComb : public QObject {
   void newClkCorrections(QList<t_clkCorr>);
 
  private:
-  enum e_method{singleEpoch, filter};
+  enum e_method{singleEpoch, filter, sparseFilter};
 
   class cmbParam {
    public:
@@ -63,6 +63,19 @@ class bncComb : public QObject {
     unsigned numObs;
   };
 
+  // Satellite-specific offsets of all ACs for one satellite (sparse filter)
+  class cmbSatBlock {
+   public:
+    cmbSatBlock() {
+      iClk = 0;
+    }
+    ~cmbSatBlock() {}
+    QString                 prn;
+    int                     iClk;   // index of the satellite clock parameter
+    QVector<int>            iOff;   // indices of the offsets, one per AC
+    NEWMAT::SymmetricMatrix QQ;     // covariance matrix of the offsets
+  };
+
   class cmbCorr {
    public:
     cmbCorr() {
@@ -100,6 +113,8 @@ class bncComb : public QObject {
                             NEWMAT::ColumnVector& dx);
   t_irc processEpoch_singleEpoch(QTextStream& out, QMap<QString, cmbCorr*>& resCorr,
                                  NEWMAT::ColumnVector& dx);
+  t_irc processEpoch_sparse(QTextStream& out, QMap<QString, cmbCorr*>& resCorr,
+                            NEWMAT::ColumnVector& dx);
   t_irc createAmat(NEWMAT::Matrix& AA, NEWMAT::ColumnVector& ll, NEWMAT::DiagonalMatrix& PP,
                    const NEWMAT::ColumnVector& x0, QMap<QString, cmbCorr*>& resCorr);
   void  dumpResults(const QMap<QString, cmbCorr*>& resCorr);
@@ -115,14 +130,18 @@ class bncComb : public QObject {
   QMap<bncTime, cmbEpoch>                _buffer;
   bncRtnetDecoder*                       _rtnetDecoder;
   NEWMAT::SymmetricMatrix                _QQ;
+  QVector<cmbSatBlock*>                  _satBlocks;
+  QMap<QString, int>                     _satBlockIndex;
+  NEWMAT::ColumnVector                   _sigmas;
   QByteArray                             _log;
-  bncAntex*                              _antex;
+  QSharedPointer<const bncAntex>         _antex;
   double                                 _MAXRES;
   QString                                _masterOrbitAC;
   unsigned                               _masterMissingEpochs;
   e_method                               _method;
   bool                                   _useGlonass;
   int                                    _cmbSampl;
+  bool                                   _cmbTiming;
   QMap<QString, QMap<t_prn, t_orbCorr> > _orbCorrections;
   bncEphUser                             _ephUser;
 };
@@ -528,6 +528,8 @@ QString t_ephGPS::toString(double version) const {
 //////////////////////////////////////////////////////////////////////////////
 t_ephGlo::t_ephGlo(float rnxVersion, const QStringList& lines) {
 
+  _orbit = QSharedPointer<t_gloOrbit>(new t_gloOrbit);
+
   const int nLines = 4;
 
   if (lines.size() != nLines) {
@@ -643,92 +645,103 @@ t_irc t_ephGlo::position(int GPSweek, double GPSweeks, double* xc, double* vv) c
     return failure;
   }
 
-  static const double nominalStep = 10.0;
-
   memset(xc, 0, 4*sizeof(double));
   memset(vv, 0, 3*sizeof(double));
 
-  double dtPos = bncTime(GPSweek, GPSweeks) - _tt;
+  bncTime tt(GPSweek, GPSweeks);
 
-  if (fabs(dtPos) > 24*3600.0) {
+  double xv[6];
+  if (glo_state(tt - _tt, xv) != success) {
     return failure;
   }
 
-  int nSteps  = int(fabs(dtPos) / nominalStep) + 1;
-  double step = dtPos / nSteps;
-
-  double acc[3];
-  acc[0] = _x_acceleration * 1.e3;
-  acc[1] = _y_acceleration * 1.e3;
-  acc[2] = _z_acceleration * 1.e3;
-  for (int ii = 1; ii <= nSteps; ii++) {
-    _xv = rungeKutta4(_tt.gpssec(), _xv, step, acc, glo_deriv);
-    _tt = _tt + step;
-  }
-
   // Position and Velocity
   // ---------------------
-  xc[0] = _xv(1);
-  xc[1] = _xv(2);
-  xc[2] = _xv(3);
+  xc[0] = xv[0];
+  xc[1] = xv[1];
+  xc[2] = xv[2];
 
-  vv[0] = _xv(4);
-  vv[1] = _xv(5);
-  vv[2] = _xv(6);
+  vv[0] = xv[3];
+  vv[1] = xv[4];
+  vv[2] = xv[5];
 
   // Clock Correction
   // ----------------
-  double dtClk = bncTime(GPSweek, GPSweeks) - _TOC;
+  double dtClk = tt - _TOC;
   xc[3] = -_tau + _gamma * dtClk;
 
   return success;
 }
 
-t_irc t_ephGlo::position(int GPSweek, double GPSweeks, NEWMAT::ColumnVector &xc,  NEWMAT::ColumnVector &vv) const
-{
-    if (_checkState == bad)
-      return failure;
+// Compute Glonass Satellite Position (virtual)
+////////////////////////////////////////////////////////////////////////////
+t_irc t_ephGlo::position(int GPSweek, double GPSweeks, ColumnVector& xc, ColumnVector& vv) const {
 
-    static const double nominalStep = 10.0;
+  xc.ReSize(4);
+  vv.ReSize(3);
 
-    xc.ReSize(4);
-    vv.ReSize(3);
+  double xcDbl[4];
+  double vvDbl[3];
+  t_irc irc = position(GPSweek, GPSweeks, xcDbl, vvDbl);
 
-    double dtPos = bncTime(GPSweek, GPSweeks) - _tt;
+  for (int ii = 0; ii < 3; ii++) {
+    xc(ii+1) = xcDbl[ii];
+    vv(ii+1) = vvDbl[ii];
+  }
+  xc(4) = xcDbl[3];
 
-    if (fabs(dtPos) > 24*3600.0)
-      return failure;
+  return irc;
+}
 
-    int nSteps  = int(fabs(dtPos) / nominalStep) + 1;
-    double step = dtPos / nSteps;
+// Status vector at time _tt + dt. The orbit is integrated from the
+// broadcast state in fixed steps of NODESTEP seconds; the states at the
+// steps are kept, a query does a single Runge-Kutta step from the nearest
+// one. Results do not depend on earlier queries.
+////////////////////////////////////////////////////////////////////////////
+t_irc t_ephGlo::glo_state(double dt, double* xv) const {
 
-    double acc[] = { _x_acceleration * 1.e3,
-                     _y_acceleration * 1.e3,
-                     _z_acceleration * 1.e3};
+  static const double NODESTEP = 10.0;
 
-    for (int ii = 1; ii <= nSteps; ii++)
-    {
-      _xv = rungeKutta4(_tt.gpssec(), _xv, step, acc, glo_deriv);
-      _tt = _tt + step;
-    }
-
-    // Position and Velocity
-    // ---------------------
-    xc(1) = _xv(1);
-    xc(2) = _xv(2);
-    xc(3) = _xv(3);
+  if (fabs(dt) > 24*3600.0 || _xv.Nrows() != 6) {
+    return failure;
+  }
 
-    vv(1) = _xv(4);
-    vv(2) = _xv(5);
-    vv(3) = _xv(6);
+  double acc[3];
+  acc[0] = _x_acceleration * 1.e3;
+  acc[1] = _y_acceleration * 1.e3;
+  acc[2] = _z_acceleration * 1.e3;
 
-    // Clock Correction
-    // ----------------
-    double dtClk = bncTime(GPSweek, GPSweeks) - _TOC;
-    xc(4) = -_tau + _gamma * dtClk;
+  int    iNode = int(floor(fabs(dt) / NODESTEP + 0.5));
+  int    iDir  = (dt < 0.0) ? 1 : 0;
+  double step  = (dt < 0.0) ? -NODESTEP : NODESTEP;
+
+  // Node nearest to the requested time (extend the table if necessary)
+  // -------------------------------------------------------------------
+  {
+    QMutexLocker locker(&_orbit->_mutex);
+    std::vector<double>& nodes = _orbit->_nodes[iDir];
+    if (nodes.empty()) {
+      for (int ii = 0; ii < 6; ii++) {
+        nodes.push_back(_xv(ii+1));
+      }
+    }
+    while (int(nodes.size()) / 6 <= iNode) {
+      double next[6];
+      memcpy(next, &nodes[nodes.size() - 6], sizeof(next));
+      glo_step(next, step, acc);
+      nodes.insert(nodes.end(), next, next + 6);
+    }
+    memcpy(xv, &nodes[6 * iNode], 6 * sizeof(double));
+  }
 
-    return success;
+  // Remaining part (at most half a step)
+  // ------------------------------------
+  double rest = dt - (iDir ? -iNode : iNode) * NODESTEP;
+  if (rest != 0.0) {
+    glo_step(xv, rest, acc);
+  }
 
+  return success;
 }
 
 // RINEX Format String
@@ -769,13 +782,12 @@ QString t_ephGlo::toString(double version) const {
 
 // Derivative of the state vector using a simple force model (static)
 ////////////////////////////////////////////////////////////////////////////
-ColumnVector t_ephGlo::glo_deriv(double /* tt */, const ColumnVector& xv,
-                                 double* acc) {
+void t_ephGlo::glo_deriv(const double* xv, const double* acc, double* va) {
 
   // State vector components
   // -----------------------
-  ColumnVector rr = xv.Rows(1,3);
-  ColumnVector vv = xv.Rows(4,6);
+  const double* rr = xv;
+  const double* vv = xv + 3;
 
   // Acceleration
   // ------------
@@ -784,24 +796,45 @@ ColumnVector t_ephGlo::glo_deriv(double /* tt */, const ColumnVector& xv,
   static const double OMEGA = 7292115.e-11;
   static const double C20   = -1082.6257e-6;
 
-  double rho = rr.NormFrobenius();
+  double rho = sqrt(rr[0]*rr[0] + rr[1]*rr[1] + rr[2]*rr[2]);
   double t1  = -gmWGS/(rho*rho*rho);
   double t2  = 3.0/2.0 * C20 * (gmWGS*AE*AE) / (rho*rho*rho*rho*rho);
   double t3  = OMEGA * OMEGA;
   double t4  = 2.0 * OMEGA;
-  double z2  = rr(3) * rr(3);
+  double z2  = rr[2] * rr[2];
 
   // Vector of derivatives
   // ---------------------
-  ColumnVector va(6);
-  va(1) = vv(1);
-  va(2) = vv(2);
-  va(3) = vv(3);
-  va(4) = (t1 + t2*(1.0-5.0*z2/(rho*rho)) + t3) * rr(1) + t4*vv(2) + acc[0];
-  va(5) = (t1 + t2*(1.0-5.0*z2/(rho*rho)) + t3) * rr(2) - t4*vv(1) + acc[1];
-  va(6) = (t1 + t2*(3.0-5.0*z2/(rho*rho))     ) * rr(3)            + acc[2];
-
-  return va;
+  va[0] = vv[0];
+  va[1] = vv[1];
+  va[2] = vv[2];
+  va[3] = (t1 + t2*(1.0-5.0*z2/(rho*rho)) + t3) * rr[0] + t4*vv[1] + acc[0];
+  va[4] = (t1 + t2*(1.0-5.0*z2/(rho*rho)) + t3) * rr[1] - t4*vv[0] + acc[1];
+  va[5] = (t1 + t2*(3.0-5.0*z2/(rho*rho))     ) * rr[2]            + acc[2];
+}
+
+// One Runge-Kutta 4 step of the state vector (static)
+////////////////////////////////////////////////////////////////////////////
+void t_ephGlo::glo_step(double* xv, double step, const double* acc) {
+
+  double k1[6], k2[6], k3[6], k4[6], tmp[6];
+
+  glo_deriv(xv, acc, k1);
+  for (int ii = 0; ii < 6; ii++) {
+    tmp[ii] = xv[ii] + 0.5 * step * k1[ii];
+  }
+  glo_deriv(tmp, acc, k2);
+  for (int ii = 0; ii < 6; ii++) {
+    tmp[ii] = xv[ii] + 0.5 * step * k2[ii];
+  }
+  glo_deriv(tmp, acc, k3);
+  for (int ii = 0; ii < 6; ii++) {
+    tmp[ii] = xv[ii] + step * k3[ii];
+  }
+  glo_deriv(tmp, acc, k4);
+  for (int ii = 0; ii < 6; ii++) {
+    xv[ii] += step / 6.0 * (k1[ii] + 2.0 * k2[ii] + 2.0 * k3[ii] + k4[ii]);
+  }
 }
 
 // IOD of Glonass Ephemeris (virtual)
@@ -5,6 +5,7 @@
 #include <QtCore>
 #include <stdio.h>
 #include <string>
+#include <vector>
 #include "bnctime.h"
 #include "bncconst.h"
 #include "t_prn.h"
@@ -34,6 +35,8 @@ class t_eph {
   t_irc   getCrd(const bncTime& tt, NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& vv, bool useCorr) const;
   void    setOrbCorr(const t_orbCorr* orbCorr);
   void    setClkCorr(const t_clkCorr* clkCorr);
+  const t_orbCorr* orbCorr() const {return _orbCorr;}
+  const t_clkCorr* clkCorr() const {return _clkCorr;}
   const QDateTime& receptDateTime() const {return _receptDateTime;}
   static QString rinexDateStr(const bncTime& tt, const t_prn& prn, double version);
   static QString rinexDateStr(const bncTime& tt, const QString& prnStr, double version);
@@ -136,11 +139,20 @@ class t_ephGPS : public t_eph {
   double  _fitInterval;     // Fit interval
 };
 
+// States of a GLONASS orbit integrated from the broadcast state in fixed
+// steps (built on demand, shared by all copies of an ephemeris)
+class t_gloOrbit {
+ public:
+  QMutex              _mutex;
+  std::vector<double> _nodes[2];  // forward/backward from TOC, 6 values each
+};
+
 class t_ephGlo : public t_eph {
  friend class t_ephEncoder;
  friend class RTCM3Decoder;
  public:
   t_ephGlo() {
+    _orbit = QSharedPointer<t_gloOrbit>(new t_gloOrbit);
     _xv.ReSize(6);
     _gps_utc          = 0.0;
     _tau              = 0.0;
@@ -170,10 +182,13 @@ class t_ephGlo : public t_eph {
  private:
   virtual t_irc position(int GPSweek, double GPSweeks, double* xc, double* vv) const;
   virtual t_irc position(int GPSweek, double GPSweeks, NEWMAT::ColumnVector &xc,  NEWMAT::ColumnVector &vv) const;
-  static NEWMAT::ColumnVector glo_deriv(double /* tt */, const NEWMAT::ColumnVector& xv, double* acc);
+  static void glo_deriv(const double* xv, const double* acc, double* va);
+  static void glo_step(double* xv, double step, const double* acc);
+  t_irc       glo_state(double dt, double* xv) const;
 
-  mutable bncTime      _tt;  // time
-  mutable NEWMAT::ColumnVector _xv;  // status vector (position, velocity) at time _tt
+  bncTime              _tt;  // time of the broadcast state
+  NEWMAT::ColumnVector _xv;  // broadcast status vector (position, velocity) at time _tt
+  QSharedPointer<t_gloOrbit> _orbit;
 
   double  _gps_utc;
   double  _tau;              // [s]
@@ -0,0 +1,342 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      t_pppBatch, t_pppBatchInput
+ *
+ * Purpose:    Parallel post-processing PPP of many RINEX observation files
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+#include "pppBatch.h"
+#include "pppRun.h"
+#include "bnccore.h"
+#include "bncsettings.h"
+#include "ephemeris.h"
+#include "rinex/rnxnavfile.h"
+#include "rinex/corrfile.h"
+
+using namespace BNC_PPP;
+using namespace std;
+
+// Constructor - read navigation and correction file
+////////////////////////////////////////////////////////////////////////////
+t_pppBatchInput::t_pppBatchInput(const t_pppOptions* opt) {
+
+  _rnxNavFile = new t_rnxNavFile(QString(opt->_rinexNav.c_str()), t_rnxNavFile::input);
+  _corrFile   = 0;
+  _hasCorr    = !opt->_corrFile.empty();
+
+  if (_hasCorr) {
+    _corrFile = new t_corrFile(QString(opt->_corrFile.c_str()));
+    connect(_corrFile, SIGNAL(newTec(t_vTec)),
+            this, SLOT(slotNewTec(t_vTec)));
+    connect(_corrFile, SIGNAL(newOrbCorrections(QList<t_orbCorr>)),
+            this, SLOT(slotNewOrbCorrections(QList<t_orbCorr>)));
+    connect(_corrFile, SIGNAL(newClkCorrections(QList<t_clkCorr>)),
+            this, SLOT(slotNewClkCorrections(QList<t_clkCorr>)));
+    connect(_corrFile, SIGNAL(newCodeBiases(QList<t_satCodeBias>)),
+            this, SLOT(slotNewCodeBiases(QList<t_satCodeBias>)));
+    connect(_corrFile, SIGNAL(newPhaseBiases(QList<t_satPhaseBias>)),
+            this, SLOT(slotNewPhaseBiases(QList<t_satPhaseBias>)));
+
+    // Read the whole file (stops with an exception at its end)
+    // --------------------------------------------------------
+    try {
+      _corrFile->syncRead(bncTime(9999, 0.0));
+      _corrEndMsg = "t_corrFile: end of file";
+    }
+    catch (const char* msg) {
+      _corrEndMsg = msg;
+    }
+    catch (const string& msg) {
+      _corrEndMsg = msg;
+    }
+    catch (...) {
+      _corrEndMsg = "unknown exceptions in corrFile";
+    }
+
+    delete _corrFile;
+    _corrFile = 0;
+  }
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+t_pppBatchInput::~t_pppBatchInput() {
+  delete _rnxNavFile;
+  delete _corrFile;
+}
+
+// All ephemerides (owned by the navigation file)
+////////////////////////////////////////////////////////////////////////////
+vector<t_eph*> t_pppBatchInput::ephs() const {
+  return _rnxNavFile->ephs();
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatchInput::slotNewOrbCorrections(QList<t_orbCorr> orbCorr) {
+  t_corrRecord rec(t_corrRecord::orbCorr, _corrFile->lastEpoTime());
+  rec._orbCorr = orbCorr;
+  _corrRecords.push_back(rec);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatchInput::slotNewClkCorrections(QList<t_clkCorr> clkCorr) {
+  t_corrRecord rec(t_corrRecord::clkCorr, _corrFile->lastEpoTime());
+  rec._clkCorr = clkCorr;
+  _corrRecords.push_back(rec);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatchInput::slotNewCodeBiases(QList<t_satCodeBias> codeBiases) {
+  t_corrRecord rec(t_corrRecord::codeBias, _corrFile->lastEpoTime());
+  rec._codeBiases = codeBiases;
+  _corrRecords.push_back(rec);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatchInput::slotNewPhaseBiases(QList<t_satPhaseBias> phaseBiases) {
+  t_corrRecord rec(t_corrRecord::phaseBias, _corrFile->lastEpoTime());
+  rec._phaseBiases = phaseBiases;
+  _corrRecords.push_back(rec);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatchInput::slotNewTec(t_vTec vTec) {
+  t_corrRecord rec(t_corrRecord::vTec, _corrFile->lastEpoTime());
+  rec._vTec = vTec;
+  _corrRecords.push_back(rec);
+}
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_pppBatch::t_pppBatch(const QList<t_pppOptions*>& options, int numWorkers) : QThread(0) {
+
+  _options    = options;
+  _numWorkers = numWorkers > 0 ? numWorkers : QThread::idealThreadCount();
+  _input      = 0;
+  _stopFlag   = false;
+  _numEpochs  = 0;
+
+  connect(this, SIGNAL(finished()), this, SLOT(deleteLater()));
+
+  connect(this, SIGNAL(newMessage(QByteArray,bool)),
+          BNC_CORE, SLOT(slotMessage(const QByteArray,bool)));
+  connect(this, SIGNAL(progressRnxPPP(int)), BNC_CORE, SIGNAL(progressRnxPPP(int)));
+  connect(this, SIGNAL(finishedRnxPPP()),    BNC_CORE, SIGNAL(finishedRnxPPP()));
+  connect(BNC_CORE, SIGNAL(stopRinexPPP()), this, SLOT(slotSetStopFlag()));
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+t_pppBatch::~t_pppBatch() {
+  for (int ii = 0; ii < _stations.size(); ii++) {
+    delete _stations[ii];
+  }
+  delete _input;
+}
+
+// Run (virtual)
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatch::run() {
+
+  QElapsedTimer timer;
+  timer.start();
+
+  if (!_options.isEmpty()) {
+    _input = new t_pppBatchInput(_options.first());
+  }
+  qint64 msecInput = timer.elapsed();
+
+  emit newMessage(QString("pppBatch: %1 stations on %2 worker threads, input read in %3 s")
+                  .arg(_options.size()).arg(_numWorkers)
+                  .arg(msecInput / 1000.0, 0, 'f', 1).toLatin1(), true);
+
+  // All stations are listed before the first task starts (the list is
+  // iterated by slotSetStopFlag in the GUI thread)
+  // ------------------------------------------------------------------
+  {
+    QMutexLocker locker(&_mutex);
+    for (int ii = 0; ii < _options.size(); ii++) {
+      t_station* station = new t_station;
+      station->_opt = _options[ii];
+      _stations << station;
+    }
+  }
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(_numWorkers);
+  for (int ii = 0; ii < _stations.size(); ii++) {
+    pool.start(new t_task(this, _stations[ii]));
+  }
+  pool.waitForDone();
+
+  writeSummary(msecInput, timer.elapsed());
+
+  emit finishedRnxPPP();
+
+  if (BNC_CORE->mode() != t_bncCore::interactive) {
+    qApp->exit(0);
+  }
+  else {
+    BNC_CORE->stopPPP();
+  }
+}
+
+// Process one station (called in a worker thread)
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatch::process(t_station* station) {
+
+  QElapsedTimer timer;
+  timer.start();
+
+  // Exceptions mark the station failed, the other stations go on
+  // ------------------------------------------------------------
+  t_pppRun*  pppRun = 0;
+  QByteArray errMsg;
+  bool       caught = true;
+  try {
+    pppRun = new t_pppRun(station->_opt);
+    {
+      QMutexLocker locker(&_mutex);
+      if (_stopFlag) {
+        delete pppRun;
+        return;
+      }
+      station->_pppRun = pppRun;
+    }
+
+    station->_irc = pppRun->processBatch(_input);
+    caught = false;
+  }
+  catch (t_except exc) {
+    errMsg = exc.what().c_str();
+  }
+  catch (const char* msg) {
+    errMsg = msg;
+  }
+  catch (const string& msg) {
+    errMsg = msg.c_str();
+  }
+  catch (std::exception& exc) {
+    errMsg = exc.what();
+  }
+  catch (...) {
+    errMsg = "unknown exception";
+  }
+
+  {
+    QMutexLocker locker(&_mutex);
+    station->_pppRun = 0;
+  }
+  if (pppRun) {
+    station->_numEpochs    = pppRun->numEpochs();
+    station->_numSolutions = pppRun->numSolutions();
+    delete pppRun;
+  }
+  if (caught) {
+    station->_irc = failure;
+    emit newMessage("PPP batch " + QByteArray(station->_opt->_roverName.c_str())
+                    + ": " + errMsg, true);
+  }
+
+  station->_msec = timer.elapsed();
+
+  QMutexLocker locker(&_mutex);
+  _numEpochs += station->_numEpochs;
+  emit progressRnxPPP(_numEpochs);
+}
+
+// Stop all stations
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatch::slotSetStopFlag() {
+  QMutexLocker locker(&_mutex);
+  _stopFlag = true;
+  for (int ii = 0; ii < _stations.size(); ii++) {
+    if (_stations[ii]->_pppRun) {
+      _stations[ii]->_pppRun->slotSetStopFlag();
+    }
+  }
+}
+
+// Summary of all stations with timing (logfile and PPP log directory)
+////////////////////////////////////////////////////////////////////////////
+void t_pppBatch::writeSummary(qint64 msecInput, qint64 msecTotal) {
+
+  ostringstream str;
+  str.setf(ios::fixed);
+  str << "PPP batch summary " << QDateTime::currentDateTime().toUTC().toString(Qt::ISODate).toLatin1().data() << endl
+      << "Stations " << _stations.size() << ", worker threads " << _numWorkers
+      << ", input " << setprecision(1) << msecInput / 1000.0 << " s"
+      << ", total " << setprecision(1) << msecTotal / 1000.0 << " s" << endl
+      << "Station   Epochs Solutions   Time[s] Status  Observation file" << endl;
+
+  qint64 msecSum = 0;
+  for (int ii = 0; ii < _stations.size(); ii++) {
+    const t_station* station = _stations[ii];
+    msecSum += station->_msec;
+    str << left << setw(9) << station->_opt->_roverName << right
+        << setw(7)  << station->_numEpochs
+        << setw(10) << station->_numSolutions
+        << setw(10) << setprecision(1) << station->_msec / 1000.0
+        << (station->_irc == success ? "  ok      " : "  failed  ")
+        << station->_opt->_rinexObs << endl;
+  }
+  if (msecTotal > 0) {
+    str << "Sum of station times " << setprecision(1) << msecSum / 1000.0
+        << " s, speed-up " << setprecision(2) << double(msecSum) / msecTotal << endl;
+  }
+
+  emit newMessage(QByteArray(str.str().c_str()), false);
+
+  bncSettings settings;
+  QString logPath = settings.value("PPP/logPath").toString();
+  if (!logPath.isEmpty()) {
+    if (logPath[logPath.length()-1] != QDir::separator()) {
+      logPath += QDir::separator();
+    }
+    QFile file(logPath + "pppBatch.sum");
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+      file.write(str.str().c_str());
+    }
+  }
+}
@@ -0,0 +1,151 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+#ifndef PPPBATCH_H
+#define PPPBATCH_H
+
+#include <string>
+#include <vector>
+#include <QtCore>
+
+#include "bncconst.h"
+#include "bnctime.h"
+#include "satObs.h"
+#include "pppOptions.h"
+
+class t_eph;
+class t_rnxNavFile;
+class t_corrFile;
+
+namespace BNC_PPP {
+
+class t_pppRun;
+
+// Contents of the navigation and correction files, read once and used
+// (read-only) by all stations of a batch post-processing run
+class t_pppBatchInput : public QObject {
+ Q_OBJECT
+ public:
+  class t_corrRecord {
+   public:
+    enum e_type {orbCorr, clkCorr, codeBias, phaseBias, vTec};
+    t_corrRecord(e_type type, const bncTime& time) {
+      _type = type;
+      _time = time;
+    }
+    e_type                _type;
+    bncTime               _time;
+    QList<t_orbCorr>      _orbCorr;
+    QList<t_clkCorr>      _clkCorr;
+    QList<t_satCodeBias>  _codeBiases;
+    QList<t_satPhaseBias> _phaseBiases;
+    t_vTec                _vTec;
+  };
+
+  t_pppBatchInput(const t_pppOptions* opt);
+  ~t_pppBatchInput();
+
+  std::vector<t_eph*>              ephs() const;
+  bool                             hasCorr() const {return _hasCorr;}
+  const std::vector<t_corrRecord>& corrRecords() const {return _corrRecords;}
+  const std::string&               corrEndMsg() const {return _corrEndMsg;}
+
+ private slots:
+  void slotNewOrbCorrections(QList<t_orbCorr> orbCorr);
+  void slotNewClkCorrections(QList<t_clkCorr> clkCorr);
+  void slotNewCodeBiases(QList<t_satCodeBias> codeBiases);
+  void slotNewPhaseBiases(QList<t_satPhaseBias> phaseBiases);
+  void slotNewTec(t_vTec vTec);
+
+ private:
+  t_rnxNavFile*             _rnxNavFile;
+  t_corrFile*               _corrFile;     // only while reading
+  bool                      _hasCorr;
+  std::vector<t_corrRecord> _corrRecords;
+  std::string               _corrEndMsg;   // reason why reading stopped
+};
+
+// Post-processing of many RINEX observation files in parallel
+class t_pppBatch : public QThread {
+ Q_OBJECT
+ public:
+  t_pppBatch(const QList<t_pppOptions*>& options, int numWorkers);
+  ~t_pppBatch();
+  virtual void run();
+
+ signals:
+  void newMessage(QByteArray msg, bool showOnScreen);
+  void progressRnxPPP(int);
+  void finishedRnxPPP();
+
+ private slots:
+  void slotSetStopFlag();
+
+ private:
+  class t_station {
+   public:
+    t_station() {
+      _opt          = 0;
+      _pppRun       = 0;
+      _irc          = failure;
+      _numEpochs    = 0;
+      _numSolutions = 0;
+      _msec         = 0;
+    }
+    const t_pppOptions* _opt;
+    t_pppRun*           _pppRun;
+    t_irc               _irc;
+    int                 _numEpochs;
+    int                 _numSolutions;
+    qint64              _msec;
+  };
+
+  class t_task : public QRunnable {
+   public:
+    t_task(t_pppBatch* batch, t_station* station) {
+      _batch   = batch;
+      _station = station;
+    }
+    virtual void run() {_batch->process(_station);}
+   private:
+    t_pppBatch* _batch;
+    t_station*  _station;
+  };
+
+  void process(t_station* station);
+  void writeSummary(qint64 msecInput, qint64 msecTotal);
+
+  QList<t_pppOptions*>    _options;
+  int                     _numWorkers;
+  QVector<t_station*>     _stations;
+  t_pppBatchInput*        _input;
+  QMutex                  _mutex;
+  bool                    _stopFlag;
+  int                     _numEpochs;
+};
+
+}
+
+#endif
@@ -51,7 +51,10 @@ using namespace std;
 // Constructor
 //////////////////////////////////////////////////////////////////////////////
 t_pppMain::t_pppMain() {
-  _running = false;
+  _running      = false;
+  _realTime     = false;
+  _batch        = false;
+  _pppScheduler = 0;
 }
 
 // Destructor
@@ -74,6 +77,28 @@ void t_pppMain::start() {
   try {
     readOptions();
 
+    // Real-time clients on a pool of worker threads
+    // ---------------------------------------------
+    bncSettings settings;
+    int numWorkers = settings.value("PPP/workerThreads").toInt();
+    if (_realTime && numWorkers > 0 && _options.size() > 0 &&
+        BNC_CORE->mode() != t_bncCore::batchPostProcessing) {
+      _pppScheduler = new t_pppScheduler(_options, numWorkers);
+      _running = true;
+      return;
+    }
+
+    // Many RINEX files post-processed on a pool of worker threads
+    // -----------------------------------------------------------
+    if (_batch && _options.size() > 0) {
+      t_pppBatch* pppBatch = new t_pppBatch(_options, numWorkers);
+      pppBatch->start();
+      _running = true;
+      return;
+    }
+
+    // One thread per client
+    // ---------------------
     QListIterator<t_pppOptions*> iOpt(_options);
     while (iOpt.hasNext()) {
       const t_pppOptions* opt = iOpt.next();
@@ -97,6 +122,11 @@ void t_pppMain::stop() {
     return;
   }
 
+  if (_pppScheduler) {
+    delete _pppScheduler;
+    _pppScheduler = 0;
+  }
+
   if (_realTime) {
     QListIterator<t_pppThread*> it(_pppThreads);
     while (it.hasNext()) {
@@ -130,6 +160,7 @@ void t_pppMain::readOptions() {
   bncSettings settings;
 
   _realTime = false;
+  _batch    = false;
   if      (settings.value("PPP/dataSource").toString() == "Real-Time Streams") {
     _realTime = true;
   }
@@ -140,9 +171,45 @@ void t_pppMain::readOptions() {
     return;
   }
 
-  QListIterator<QString> iSta(settings.value("PPP/staTable").toStringList());
-  while (iSta.hasNext()) {
-    QStringList hlp = iSta.next().split(",");
+  // Pairs of staTable row and RINEX observation file
+  // -------------------------------------------------
+  QStringList staTable = settings.value("PPP/staTable").toStringList();
+  QList< QPair<QString, QString> > jobs;
+  QStringList obsBatch;
+  if (!_realTime) {
+    obsBatch = batchObsFiles();
+  }
+  if (!obsBatch.isEmpty()) {
+    if (staTable.isEmpty()) {
+      throw t_except("pppMain: option staTable required for rinexObsBatch");
+    }
+    _batch = true;
+    for (int ii = 0; ii < obsBatch.size(); ii++) {
+      QString staName = QFileInfo(obsBatch[ii]).fileName().left(4).toUpper();
+      QString row;
+      for (int iRow = 0; iRow < staTable.size(); iRow++) {
+        if (staTable[iRow].section(",", 0, 0).left(4).toUpper() == staName) {
+          row = staTable[iRow];
+          break;
+        }
+      }
+      if (row.isEmpty()) {
+        QStringList hlp = staTable.first().split(",");
+        hlp[0] = staName;
+        row = hlp.join(",");
+      }
+      jobs << QPair<QString, QString>(row, obsBatch[ii]);
+    }
+  }
+  else {
+    QString rinexObs = settings.value("PPP/rinexObs").toString();
+    for (int iRow = 0; iRow < staTable.size(); iRow++) {
+      jobs << QPair<QString, QString>(staTable[iRow], rinexObs);
+    }
+  }
+
+  for (int iJob = 0; iJob < jobs.size(); iJob++) {
+    QStringList hlp = jobs[iJob].first.split(",");
 
     if (hlp.size() < 10) {
       throw t_except("pppMain: wrong option staTable");
@@ -166,7 +233,7 @@ void t_pppMain::readOptions() {
       opt->_corrMount.assign(settings.value("PPP/corrMount").toString().toStdString());
     }
     else {
-      opt->_rinexObs.assign(settings.value("PPP/rinexObs").toString().toStdString());
+      opt->_rinexObs.assign(jobs[iJob].second.toStdString());
       opt->_rinexNav.assign(settings.value("PPP/rinexNav").toString().toStdString());
       opt->_corrFile.assign(settings.value("PPP/corrFile").toString().toStdString());
     }
@@ -390,6 +457,10 @@ void t_pppMain::readOptions() {
     opt->_eleWgtCode  = (settings.value("PPP/eleWgtCode").toInt() != 0);
     opt->_eleWgtPhase = (settings.value("PPP/eleWgtPhase").toInt() != 0);
     opt->_seedingTime = settings.value("PPP/seedingTime").toDouble();
+    opt->_filter      = settings.value("PPP/filter").toString().toStdString();
+    opt->_filterTiming = (settings.value("PPP/filterTiming").toInt() != 0);
+    opt->_outlierMode = settings.value("PPP/outlierMode").toString().toStdString();
+    opt->_smoothing   = (settings.value("PPP/smoothing").toInt() != 0);
 
     // Some default values
     // -------------------
@@ -400,3 +471,28 @@ void t_pppMain::readOptions() {
   }
 }
 
+
+// RINEX observation files of a batch run (comma-separated, wildcards allowed)
+//////////////////////////////////////////////////////////////////////////////
+QStringList t_pppMain::batchObsFiles() const {
+
+  QStringList fileNames;
+
+  bncSettings settings;
+  QStringList patterns = settings.value("PPP/rinexObsBatch").toString().split(",", QString::SkipEmptyParts);
+  for (int ii = 0; ii < patterns.size(); ii++) {
+    QFileInfo fileInfo(patterns[ii].trimmed());
+    if (fileInfo.fileName().contains('*') || fileInfo.fileName().contains('?')) {
+      QDir dir = fileInfo.dir();
+      QStringList entries = dir.entryList(QStringList() << fileInfo.fileName(), QDir::Files, QDir::Name);
+      for (int iEnt = 0; iEnt < entries.size(); iEnt++) {
+        fileNames << dir.filePath(entries[iEnt]);
+      }
+    }
+    else {
+      fileNames << fileInfo.filePath();
+    }
+  }
+
+  return fileNames;
+}
@@ -4,6 +4,8 @@
 #include <QtCore>
 #include "pppOptions.h"
 #include "pppThread.h"
+#include "pppScheduler.h"
+#include "pppBatch.h"
 #include "bnccore.h"
 
 namespace BNC_PPP {
@@ -17,11 +19,14 @@ class t_pppMain {
 
  private:
   void readOptions();
+  QStringList batchObsFiles() const;
 
   QList<t_pppOptions*> _options;
   QList<t_pppThread*>  _pppThreads;
+  t_pppScheduler*      _pppScheduler;
   bool     _running;
   bool     _realTime;
+  bool     _batch;
 };
 
 }; // namespace BNC_PPP
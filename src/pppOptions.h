@@ -59,6 +59,10 @@ namespace BNC_PPP
             int                     _nmeaPort;
             double                  _aprSigAmb;
             double                  _seedingTime;
+            std::string             _filter;
+            bool                    _filterTiming;
+            std::string             _outlierMode;
+            bool                    _smoothing;
             std::vector<t_lc::type> _LCsGPS;
             std::vector<t_lc::type> _LCsGLONASS;
             std::vector<t_lc::type> _LCsGalileo;
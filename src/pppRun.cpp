@@ -48,6 +48,8 @@
 
 #include "pppRun.h"
 #include "pppThread.h"
+#include "pppBatch.h"
+#include "pppSmoother.h"
 #include "bnccore.h"
 #include "bncephuser.h"
 #include "bncsettings.h"
@@ -63,7 +65,7 @@ using namespace std;
 
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
-t_pppRun::t_pppRun(const t_pppOptions* opt) {
+t_pppRun::t_pppRun(const t_pppOptions* opt, bool connectSlots) {
 
   _opt = opt;
 
@@ -80,14 +82,16 @@ t_pppRun::t_pppRun(const t_pppOptions* opt) {
 
   bncSettings settings;
 
-  if (_opt->_realTime) {
+  // Real-time input is delivered by t_pppScheduler if connectSlots is false
+  // ----------------------------------------------------------------------
+  if (_opt->_realTime && connectSlots) {
     Qt::ConnectionType conType = Qt::AutoConnection;
     if (BNC_CORE->mode() == t_bncCore::batchPostProcessing) {
       conType = Qt::BlockingQueuedConnection;
     }
 
-    connect(BNC_CORE->caster(), SIGNAL(newObs(QByteArray, QList<t_satObs>)),
-            this, SLOT(slotNewObs(QByteArray, QList<t_satObs>)),conType);
+    connect(BNC_CORE->caster(), SIGNAL(newObs(t_satObsBatchPtr)),
+            this, SLOT(slotNewObs(t_satObsBatchPtr)),conType);
 
     connect(BNC_CORE, SIGNAL(newGPSEph(t_ephGPS)),
             this, SLOT(slotNewGPSEph(t_ephGPS)),conType);
@@ -125,7 +129,7 @@ t_pppRun::t_pppRun(const t_pppOptions* opt) {
     connect(BNC_CORE, SIGNAL(providerIDChanged(QString)),
             this, SLOT(slotProviderIDChanged(QString)));
   }
-  else {
+  else if (!_opt->_realTime) {
     _rnxObsFile = 0;
     _rnxNavFile = 0;
     _corrFile   = 0;
@@ -137,7 +141,9 @@ t_pppRun::t_pppRun(const t_pppOptions* opt) {
     connect(BNC_CORE, SIGNAL(stopRinexPPP()), this, SLOT(slotSetStopFlag()));
   }
 
-  _stopFlag = false;
+  _stopFlag     = false;
+  _numEpochs    = 0;
+  _numSolutions = 0;
 
   QString roverName(_opt->_roverName.c_str()), fullRoverName("");
   QString country;
@@ -178,6 +184,15 @@ t_pppRun::t_pppRun(const t_pppOptions* opt) {
     _logFile = new bncoutf(logFileSkl, intr, sampl);
   }
 
+  // Smoothed solution next to the PPP logfile (post-processing only)
+  // ----------------------------------------------------------------
+  _smtFile = 0;
+  if (_logFile && _opt->_smoothing && !_opt->_realTime) {
+    QString smtFileSkl = logFileSkl;
+    smtFileSkl.replace(smtFileSkl.length() - 4, 4, ".smt");
+    _smtFile = new bncoutf(smtFileSkl, intr, sampl);
+  }
+
   QString nmeaFileSkl = settings.value("PPP/nmeaPath").toString();
   l = nmeaFileSkl.length();
   if (nmeaFileSkl.isEmpty()) {
@@ -223,6 +238,7 @@ t_pppRun::t_pppRun(const t_pppOptions* opt) {
 ////////////////////////////////////////////////////////////////////////////
 t_pppRun::~t_pppRun() {
   delete _logFile;
+  delete _smtFile;
   delete _nmeaFile;
   delete _snxtroFile;
   while (!_epoData.empty()) {
@@ -261,19 +277,20 @@ void t_pppRun::slotNewBDSEph(t_ephBDS eph) {
 
 //
 ////////////////////////////////////////////////////////////////////////////
-void t_pppRun::slotNewObs(QByteArray staID, QList<t_satObs> obsList) {
+void t_pppRun::slotNewObs(t_satObsBatchPtr obsBatch) {
   QMutexLocker locker(&_mutex);
 
+  const QByteArray& staID = obsBatch->_staID;
   if (string(staID.data()) != _opt->_roverName) {
     return;
   }
 
-  // Loop over all observations (possible different epochs)
-  // -----------------------------------------------------
-  QListIterator<t_satObs> it(obsList);
+  // Loop over all observations (possible different epochs), the epochs
+  // refer to the observations in the shared batch
+  // ------------------------------------------------------------------
+  QListIterator<t_satObs> it(obsBatch->_obsList);
   while (it.hasNext()) {
-    const t_satObs& oldObs = it.next();
-    t_satObs*       newObs = new t_satObs(oldObs);
+    const t_satObs* newObs = &it.next();
 
     // Find the corresponding data epoch or create a new one
     // -----------------------------------------------------
@@ -297,9 +314,9 @@ void t_pppRun::slotNewObs(QByteArray staID, QList<t_satObs> obsList) {
     // -----------------------
     if (epoch != 0) {
       epoch->_satObs.push_back(newObs);
-    }
-    else {
-      delete newObs;
+      if (epoch->_batches.isEmpty() || epoch->_batches.last() != obsBatch) {
+        epoch->_batches.append(obsBatch);
+      }
     }
   }
 
@@ -315,7 +332,7 @@ void t_pppRun::slotNewObs(QByteArray staID, QList<t_satObs> obsList) {
   // ------------------------
   while (_epoData.size()) {
 
-    const vector<t_satObs*>& satObs = _epoData.front()->_satObs;
+    const vector<const t_satObs*>& satObs = _epoData.front()->_satObs;
 
     // No corrections yet, skip the epoch
     // ----------------------------------
@@ -332,6 +349,7 @@ void t_pppRun::slotNewObs(QByteArray staID, QList<t_satObs> obsList) {
       _pppClient->processEpoch(satObs, &output);
 
       if (!output._error) {
+        ++_numSolutions;
         QVector<double> xx(6);
         xx.data()[0] = output._xyzRover[0];
         xx.data()[1] = output._xyzRover[1];
@@ -529,12 +547,74 @@ void t_pppRun::processFiles() {
             this, SLOT(slotNewPhaseBiases(QList<t_satPhaseBias>)));
   }
 
-  // Read/Process Observations
-  // -------------------------
+  QElapsedTimer timer;
+  timer.start();
+  processEpochs(0);
+  smooth(timer.elapsed());
+
+  emit finishedRnxPPP();
+
+  if (BNC_CORE->mode() != t_bncCore::interactive) {
+    qApp->exit(0);
+  }
+  else {
+    BNC_CORE->stopPPP();
+  }
+}
+
+// Batch post-processing: navigation and correction file contents are
+// shared with other stations, the caller runs this in a worker thread
+////////////////////////////////////////////////////////////////////////////
+t_irc t_pppRun::processBatch(const t_pppBatchInput* batchInput) {
+
+  QString obsFileName(_opt->_rinexObs.c_str()); expandEnvVar(obsFileName);
+  QFile   obsFile(obsFileName);
+  if (!obsFile.open(QIODevice::ReadOnly)) {
+    emit newMessage(QByteArray("pppRun: cannot open observation file ")
+                    + _opt->_rinexObs.c_str(), true);
+    return failure;
+  }
+  obsFile.close();
+
+  try {
+    _rnxObsFile = new t_rnxObsFile(QString(_opt->_rinexObs.c_str()), t_rnxObsFile::input);
+  }
+  catch (...) {
+    delete _rnxObsFile; _rnxObsFile = 0;
+    emit newMessage(QByteArray("pppRun: cannot read observation file ")
+                    + _opt->_rinexObs.c_str(), true);
+    return failure;
+  }
+
+  _speed = 100;
+  QElapsedTimer timer;
+  timer.start();
+  processEpochs(batchInput);
+  smooth(timer.elapsed());
+
+  return success;
+}
+
+// Read/Process Observations
+////////////////////////////////////////////////////////////////////////////
+void t_pppRun::processEpochs(const t_pppBatchInput* batchInput) {
+
+  // Batch: release order of the ephemerides, corrections read so far
+  // -----------------------------------------------------------------
+  vector<t_eph*>              ephs;
+  t_rnxNavFile::t_ephIndex*   ephIndex = 0;
+  QMap<QString, unsigned int> batchIODs;
+  unsigned                    iCorr = 0;
+  if (batchInput) {
+    ephs     = batchInput->ephs();
+    ephIndex = new t_rnxNavFile::t_ephIndex(ephs);
+  }
+
   int   nEpo = 0;
   const t_rnxObsFile::t_rnxEpo* epo = 0;
   while ( !_stopFlag && (epo = _rnxObsFile->nextEpoch()) != 0 ) {
     ++nEpo;
+    _numEpochs = nEpo;
 
     if (_speed < 100) {
       double sleepTime = 2.0 / _speed;
@@ -543,7 +623,38 @@ void t_pppRun::processFiles() {
 
     // Get Corrections
     // ---------------
-    if (_corrFile) {
+    if (batchInput && batchInput->hasCorr()) {
+      const vector<t_pppBatchInput::t_corrRecord>& records = batchInput->corrRecords();
+      while (iCorr < records.size() && records[iCorr]._time <= epo->tt) {
+        const t_pppBatchInput::t_corrRecord& rec = records[iCorr++];
+        switch (rec._type) {
+        case t_pppBatchInput::t_corrRecord::orbCorr:
+          for (int ii = 0; ii < rec._orbCorr.size(); ii++) {
+            const t_orbCorr& corr = rec._orbCorr[ii];
+            batchIODs[QString(corr._prn.toInternalString().c_str())] = corr._iod;
+          }
+          slotNewOrbCorrections(rec._orbCorr);
+          break;
+        case t_pppBatchInput::t_corrRecord::clkCorr:
+          slotNewClkCorrections(rec._clkCorr);
+          break;
+        case t_pppBatchInput::t_corrRecord::codeBias:
+          slotNewCodeBiases(rec._codeBiases);
+          break;
+        case t_pppBatchInput::t_corrRecord::phaseBias:
+          slotNewPhaseBiases(rec._phaseBiases);
+          break;
+        case t_pppBatchInput::t_corrRecord::vTec:
+          slotNewTec(rec._vTec);
+          break;
+        }
+      }
+      if (iCorr == records.size()) {
+        emit newMessage(QByteArray(batchInput->corrEndMsg().c_str()), true);
+        break;
+      }
+    }
+    else if (_corrFile) {
       try {
         _corrFile->syncRead(epo->tt);
       }
@@ -563,11 +674,20 @@ void t_pppRun::processFiles() {
 
     // Get Ephemerides
     // ----------------
-    t_eph* eph = 0;
-    const QMap<QString, unsigned int>* corrIODs = _corrFile ? &_corrFile->corrIODs() : 0;
-    while ( (eph = _rnxNavFile->getNextEph(epo->tt, corrIODs)) != 0 ) {
-      _pppClient->putEphemeris(eph);
-      delete eph; eph = 0;
+    if (batchInput) {
+      const QMap<QString, unsigned int>* iods = batchInput->hasCorr() ? &batchIODs : 0;
+      int index;
+      while ( (index = ephIndex->next(epo->tt, iods)) >= 0 ) {
+        _pppClient->putEphemeris(ephs[index]);
+      }
+    }
+    else {
+      t_eph* eph = 0;
+      const QMap<QString, unsigned int>* corrIODs = _corrFile ? &_corrFile->corrIODs() : 0;
+      while ( (eph = _rnxNavFile->getNextEph(epo->tt, corrIODs)) != 0 ) {
+        _pppClient->putEphemeris(eph);
+        delete eph; eph = 0;
+      }
     }
 
     // Create list of observations and start epoch processing
@@ -580,24 +700,89 @@ void t_pppRun::processFiles() {
       t_rnxObsFile::setObsFromRnx(_rnxObsFile, epo, rnxSat, obs);
       obsList << obs;
     }
-    slotNewObs(QByteArray(_opt->_roverName.c_str()), obsList);
+    slotNewObs(t_satObsBatchPtr(new t_satObsBatch(QByteArray(_opt->_roverName.c_str()), obsList)));
+
 
+    if (!batchInput) {
+      if (nEpo % 10 == 0) {
+        emit progressRnxPPP(nEpo);
+      }
 
-    if (nEpo % 10 == 0) {
-      emit progressRnxPPP(nEpo);
+      QCoreApplication::processEvents();
     }
+  }
 
-    QCoreApplication::processEvents();
+  delete ephIndex;
+}
+
+// Backward smoothing pass after the forward run (post-processing only)
+////////////////////////////////////////////////////////////////////////////
+void t_pppRun::smooth(qint64 msecForward) {
+
+  t_pppSmoother* smoother = _pppClient->smoother();
+  if (!smoother || _stopFlag) {
+    return;
   }
 
-  emit finishedRnxPPP();
+  QElapsedTimer timer;
+  timer.start();
 
-  if (BNC_CORE->mode() != t_bncCore::interactive) {
-    qApp->exit(0);
+  vector<t_pppSmoother::t_solution> solutions;
+  if (smoother->smooth(solutions) != success) {
+    emit newMessage(QByteArray("pppRun: no epochs smoothed ") + _opt->_roverName.c_str(), true);
+    return;
   }
-  else {
-    BNC_CORE->stopPPP();
+
+  double ellApr[3];
+  if (_opt->xyzAprRoverSet()) {
+    double xyzApr[3] = {_opt->_xyzAprRover(1), _opt->_xyzAprRover(2), _opt->_xyzAprRover(3)};
+    xyz2ell(xyzApr, ellApr);
+  }
+
+  for (unsigned ii = 0; ii < solutions.size(); ii++) {
+    const t_pppSmoother::t_solution& sol = solutions[ii];
+    ostringstream str;
+    str.setf(ios::fixed);
+    str << sol._time.datestr() << "_" << sol._time.timestr(3)
+        << ' ' << _opt->_roverName << " SMT"
+        << " X = " << setprecision(4) << sol._xyz[0] << " +- " << sol._sigXyz[0]
+        << " Y = " << setprecision(4) << sol._xyz[1] << " +- " << sol._sigXyz[1]
+        << " Z = " << setprecision(4) << sol._xyz[2] << " +- " << sol._sigXyz[2];
+    if (_opt->xyzAprRoverSet()) {
+      double dxyz[3] = {sol._xyz[0] - _opt->_xyzAprRover(1),
+                        sol._xyz[1] - _opt->_xyzAprRover(2),
+                        sol._xyz[2] - _opt->_xyzAprRover(3)};
+      double neu[3];
+      xyz2neu(ellApr, dxyz, neu);
+      str << " NEU: " << showpos << setw(8) << setprecision(4) << neu[0]
+          << " "      << showpos << setw(8) << setprecision(4) << neu[1]
+          << " "      << showpos << setw(8) << setprecision(4) << neu[2] << noshowpos;
+    }
+    if (sol._hasTrp) {
+      str << " TRP: " << setw(7) << setprecision(3) << sol._trp0
+          << " "      << showpos << setw(6) << setprecision(3) << sol._trp << noshowpos
+          << " +- "   << setw(6) << setprecision(3) << sol._sigTrp;
+    }
+    str << endl;
+    if (_smtFile) {
+      _smtFile->write(sol._time.gpsw(), sol._time.gpssec(), QString(str.str().c_str()));
+    }
   }
+
+  // Extra run time and memory of the smoother
+  // -----------------------------------------
+  qint64 msecBackward = timer.elapsed();
+  ostringstream msg;
+  msg.setf(ios::fixed);
+  msg << _opt->_roverName << " smoothing: " << smoother->numEpochs() << " epochs"
+      << ", forward " << setprecision(1) << msecForward / 1000.0 << " s"
+      << ", backward " << setprecision(1) << msecBackward / 1000.0 << " s";
+  if (msecForward > 0) {
+    msg << " (+" << setprecision(0) << 100.0 * msecBackward / msecForward << "%)";
+  }
+  msg << ", temporary file " << setprecision(1) << smoother->fileSize() / 1048576.0 << " MB"
+      << ", backward pass memory " << setprecision(1) << 3 * smoother->maxStateSize() / 1024.0 << " kB";
+  emit newMessage(QByteArray(msg.str().c_str()), true);
 }
 
 //
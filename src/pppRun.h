@@ -17,13 +17,18 @@ class bncSinexTro;
 
 namespace BNC_PPP {
 
+class t_pppBatchInput;
+
 class t_pppRun : public QObject {
  Q_OBJECT
  public:
-  t_pppRun(const t_pppOptions* opt);
+  t_pppRun(const t_pppOptions* opt, bool connectSlots = true);
   ~t_pppRun();
 
-  void processFiles();
+  void  processFiles();
+  t_irc processBatch(const t_pppBatchInput* batchInput);
+  int   numEpochs() const {return _numEpochs;}
+  int   numSolutions() const {return _numSolutions;}
 
   static QString nmeaString(char strType, const t_output& output);
 
@@ -44,22 +49,22 @@ class t_pppRun : public QObject {
   void slotNewClkCorrections(QList<t_clkCorr> clkCorr);
   void slotNewCodeBiases(QList<t_satCodeBias> codeBiases);
   void slotNewPhaseBiases(QList<t_satPhaseBias> phaseBiases);
-  void slotNewObs(QByteArray staID, QList<t_satObs> obsList);
+  void slotNewObs(t_satObsBatchPtr obsBatch);
   void slotSetSpeed(int speed);
   void slotSetStopFlag();
   void slotProviderIDChanged(QString mountPoint);
 
  private:
+  void processEpochs(const t_pppBatchInput* batchInput);
+  void smooth(qint64 msecForward);
+
   class t_epoData {
    public:
     t_epoData() {}
-    ~t_epoData() {
-      for (unsigned ii = 0; ii < _satObs.size(); ii++) {
-        delete _satObs[ii];
-      }
-    }
-    bncTime                _time;
-    std::vector<t_satObs*> _satObs;
+    ~t_epoData() {}
+    bncTime                       _time;
+    std::vector<const t_satObs*>  _satObs;  // point into _batches
+    QList<t_satObsBatchPtr>       _batches;
   };
 
   QMutex                 _mutex;
@@ -75,6 +80,9 @@ class t_pppRun : public QObject {
   bncoutf*               _logFile;
   bncoutf*               _nmeaFile;
   bncSinexTro*           _snxtroFile;
+  bncoutf*               _smtFile;
+  int                    _numEpochs;
+  int                    _numSolutions;
 };
 
 }
@@ -0,0 +1,476 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+/* -------------------------------------------------------------------------
+ * BKG NTRIP Client
+ * -------------------------------------------------------------------------
+ *
+ * Class:      t_pppScheduler
+ *
+ * Purpose:    Real-time PPP clients running on a pool of worker threads
+ *
+ * Created:    17-Oct-2026
+ *
+ * Changes:
+ *
+ * -----------------------------------------------------------------------*/
+
+#include <iostream>
+
+#include "pppScheduler.h"
+#include "pppRun.h"
+#include "bnccore.h"
+#include "bnccaster.h"
+#include "combination/bnccomb.h"
+
+using namespace BNC_PPP;
+using namespace std;
+
+// Maximum age of buffered input messages [ms], stations lagging further
+// behind (e.g. without observations) are served from the snapshot
+const qint64 MAXINPUTAGE = 600 * 1000;
+
+// Interval of the latency report in the logfile [ms]
+const int REPORTINTERVAL = 3600 * 1000;
+
+const double t_pppScheduler::t_latency::_upper[NUMBIN-1] =
+  {1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0, 500.0, 1000.0, 2000.0};
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_pppScheduler::t_pppScheduler(const QList<t_pppOptions*>& options, int numWorkers) {
+
+  _firstInput = 0;
+  _clock.start();
+  _pool.setMaxThreadCount(numWorkers > 0 ? numWorkers : QThread::idealThreadCount());
+
+  connect(this, SIGNAL(newMessage(QByteArray,bool)),
+          BNC_CORE, SLOT(slotMessage(const QByteArray,bool)));
+
+  // One PPP client per station, not connected to any signal
+  // -------------------------------------------------------
+  QListIterator<t_pppOptions*> iOpt(options);
+  while (iOpt.hasNext()) {
+    const t_pppOptions* opt = iOpt.next();
+    try {
+      t_station* station = new t_station;
+      station->_staID  = QByteArray(opt->_roverName.c_str());
+      station->_pppRun = new t_pppRun(opt, false);
+      _stations[station->_staID] = station;
+    }
+    catch (t_except exc) {
+      emit newMessage(QByteArray(exc.what().c_str()), true);
+    }
+  }
+
+  emit newMessage(QString("pppScheduler: %1 stations on %2 worker threads")
+                  .arg(_stations.size()).arg(_pool.maxThreadCount()).toLatin1(), true);
+
+  // Input signals are received only once
+  // ------------------------------------
+  connect(BNC_CORE->caster(), SIGNAL(newObs(t_satObsBatchPtr)),
+          this, SLOT(slotNewObs(t_satObsBatchPtr)));
+
+  connect(BNC_CORE, SIGNAL(newGPSEph(t_ephGPS)),
+          this, SLOT(slotNewGPSEph(t_ephGPS)));
+
+  connect(BNC_CORE, SIGNAL(newGlonassEph(t_ephGlo)),
+          this, SLOT(slotNewGlonassEph(t_ephGlo)));
+
+  connect(BNC_CORE, SIGNAL(newGalileoEph(t_ephGal)),
+          this, SLOT(slotNewGalileoEph(t_ephGal)));
+
+  connect(BNC_CORE, SIGNAL(newBDSEph(t_ephBDS)),
+          this, SLOT(slotNewBDSEph(t_ephBDS)));
+
+  connect(BNC_CORE, SIGNAL(newTec(t_vTec)),
+          this, SLOT(slotNewTec(t_vTec)));
+
+  connect(BNC_CORE, SIGNAL(newOrbCorrections(QList<t_orbCorr>)),
+          this, SLOT(slotNewOrbCorrections(QList<t_orbCorr>)));
+
+  connect(BNC_CORE, SIGNAL(newClkCorrections(QList<t_clkCorr>)),
+          this, SLOT(slotNewClkCorrections(QList<t_clkCorr>)));
+
+  connect(BNC_CORE, SIGNAL(newCodeBiases(QList<t_satCodeBias>)),
+          this, SLOT(slotNewCodeBiases(QList<t_satCodeBias>)));
+
+  connect(BNC_CORE, SIGNAL(newPhaseBiases(QList<t_satPhaseBias>)),
+          this, SLOT(slotNewPhaseBiases(QList<t_satPhaseBias>)));
+
+  connect(BNC_CMB, SIGNAL(newOrbCorrections(QList<t_orbCorr>)),
+          this, SLOT(slotNewOrbCorrections(QList<t_orbCorr>)));
+
+  connect(BNC_CMB, SIGNAL(newClkCorrections(QList<t_clkCorr>)),
+          this, SLOT(slotNewClkCorrections(QList<t_clkCorr>)));
+
+  connect(BNC_CORE, SIGNAL(providerIDChanged(QString)),
+          this, SLOT(slotProviderIDChanged(QString)));
+
+  _reportTimer = new QTimer(this);
+  connect(_reportTimer, SIGNAL(timeout()), this, SLOT(slotReport()));
+  _reportTimer->start(REPORTINTERVAL);
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+t_pppScheduler::~t_pppScheduler() {
+  disconnect();
+  _pool.waitForDone();
+
+  BNC_CORE->slotMessage(latencyReport(), false);
+
+  QMapIterator<QByteArray, t_station*> it(_stations);
+  while (it.hasNext()) {
+    it.next();
+    delete it.value()->_pppRun;
+    delete it.value();
+  }
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewGPSEph(t_ephGPS eph) {
+  t_input input(t_input::GPSEph);
+  input._eph = QSharedPointer<t_eph>(new t_ephGPS(eph));
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewGlonassEph(t_ephGlo eph) {
+  t_input input(t_input::GlonassEph);
+  input._eph = QSharedPointer<t_eph>(new t_ephGlo(eph));
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewGalileoEph(t_ephGal eph) {
+  t_input input(t_input::GalileoEph);
+  input._eph = QSharedPointer<t_eph>(new t_ephGal(eph));
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewBDSEph(t_ephBDS eph) {
+  t_input input(t_input::BDSEph);
+  input._eph = QSharedPointer<t_eph>(new t_ephBDS(eph));
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewTec(t_vTec vTec) {
+  t_input input(t_input::Tec);
+  input._vTec = QSharedPointer<t_vTec>(new t_vTec(vTec));
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewOrbCorrections(QList<t_orbCorr> orbCorr) {
+  t_input input(t_input::OrbCorr);
+  input._orbCorr = orbCorr;
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewClkCorrections(QList<t_clkCorr> clkCorr) {
+  t_input input(t_input::ClkCorr);
+  input._clkCorr = clkCorr;
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewCodeBiases(QList<t_satCodeBias> codeBiases) {
+  t_input input(t_input::CodeBias);
+  input._codeBiases = codeBiases;
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewPhaseBiases(QList<t_satPhaseBias> phaseBiases) {
+  t_input input(t_input::PhaseBias);
+  input._phaseBiases = phaseBiases;
+  putInput(input);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotProviderIDChanged(QString mountPoint) {
+  t_input input(t_input::ProviderID);
+  input._mountPoint = mountPoint;
+  putInput(input);
+}
+
+// Append input message, drop messages consumed by all stations or older
+// than MAXINPUTAGE
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::putInput(t_input& input) {
+  QMutexLocker locker(&_inputMutex);
+
+  qint64 seq  = _firstInput + _inputs.size();
+  input._time = _clock.elapsed();
+  _inputs.push_back(input);
+
+  // Snapshot: latest ephemeris per satellite, biases, VTEC, provider IDs
+  // --------------------------------------------------------------------
+  switch (input._type) {
+  case t_input::GPSEph:
+  case t_input::GlonassEph:
+  case t_input::GalileoEph:
+  case t_input::BDSEph:
+    putSnapshot("EPH " + QString(input._eph->prn().toInternalString().c_str()), seq, input);
+    break;
+  case t_input::Tec:
+    putSnapshot("TEC", seq, input);
+    break;
+  case t_input::CodeBias:
+    for (int ii = 0; ii < input._codeBiases.size(); ii++) {
+      t_input hlp(t_input::CodeBias);
+      hlp._codeBiases << input._codeBiases[ii];
+      putSnapshot("CB " + QString(input._codeBiases[ii]._prn.toInternalString().c_str()), seq, hlp);
+    }
+    break;
+  case t_input::PhaseBias:
+    for (int ii = 0; ii < input._phaseBiases.size(); ii++) {
+      t_input hlp(t_input::PhaseBias);
+      hlp._phaseBiases << input._phaseBiases[ii];
+      putSnapshot("PB " + QString(input._phaseBiases[ii]._prn.toInternalString().c_str()), seq, hlp);
+    }
+    break;
+  case t_input::ProviderID:
+    putSnapshot("PID " + input._mountPoint, seq, input);
+    break;
+  default:
+    break;
+  }
+
+  qint64 minNext = _firstInput + _inputs.size();
+  QMapIterator<QByteArray, t_station*> it(_stations);
+  while (it.hasNext()) {
+    it.next();
+    if (it.value()->_nextInput < minNext) {
+      minNext = it.value()->_nextInput;
+    }
+  }
+
+  while (!_inputs.empty() &&
+         (_firstInput < minNext || input._time - _inputs.front()._time > MAXINPUTAGE)) {
+    _inputs.pop_front();
+    ++_firstInput;
+  }
+}
+
+// Replace the snapshot entry of a key (called with _inputMutex locked)
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::putSnapshot(const QString& key, qint64 seq, const t_input& input) {
+  _snapshot.insert(key, qMakePair(seq, input));
+}
+
+// New observations: queue them and schedule the station
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotNewObs(t_satObsBatchPtr obsBatch) {
+
+  t_station* station = _stations.value(obsBatch->_staID);
+  if (!station) {
+    return;
+  }
+
+  QMutexLocker locker(&station->_mutex);
+  station->_obsBatches.append(qMakePair(obsBatch, _clock.elapsed()));
+  if (!station->_scheduled) {
+    station->_scheduled = true;
+    _pool.start(new t_task(this, station));
+  }
+}
+
+// Pass all inputs not yet seen by the station to its PPP client
+// (called in a worker thread)
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::applyInput(t_station* station) {
+
+  vector<t_input> inputs;
+  int             numSnapshot = 0;
+  {
+    QMutexLocker locker(&_inputMutex);
+
+    // Station has fallen behind: latest state of the dropped messages
+    // ---------------------------------------------------------------
+    if (station->_nextInput < _firstInput) {
+      QMap<qint64, QList<t_input> > missed;
+      QMapIterator<QString, QPair<qint64, t_input> > itSnap(_snapshot);
+      while (itSnap.hasNext()) {
+        itSnap.next();
+        qint64 seq = itSnap.value().first;
+        if (seq >= station->_nextInput && seq < _firstInput) {
+          missed[seq] << itSnap.value().second;
+        }
+      }
+      QMapIterator<qint64, QList<t_input> > itMissed(missed);
+      while (itMissed.hasNext()) {
+        itMissed.next();
+        for (int ii = 0; ii < itMissed.value().size(); ii++) {
+          inputs.push_back(itMissed.value()[ii]);
+          ++numSnapshot;
+        }
+      }
+      station->_nextInput = _firstInput;
+    }
+    for (qint64 ii = station->_nextInput - _firstInput; ii < qint64(_inputs.size()); ii++) {
+      inputs.push_back(_inputs[ii]);
+    }
+    station->_nextInput = _firstInput + _inputs.size();
+  }
+
+  if (numSnapshot > 0) {
+    emit newMessage("pppScheduler " + station->_staID + ": behind input queue, "
+                    + QByteArray::number(numSnapshot) + " inputs from snapshot", false);
+  }
+
+  t_pppRun* pppRun = station->_pppRun;
+  for (unsigned ii = 0; ii < inputs.size(); ii++) {
+    const t_input& input = inputs[ii];
+    switch (input._type) {
+    case t_input::GPSEph:
+      pppRun->slotNewGPSEph(*static_cast<const t_ephGPS*>(input._eph.data()));
+      break;
+    case t_input::GlonassEph:
+      pppRun->slotNewGlonassEph(*static_cast<const t_ephGlo*>(input._eph.data()));
+      break;
+    case t_input::GalileoEph:
+      pppRun->slotNewGalileoEph(*static_cast<const t_ephGal*>(input._eph.data()));
+      break;
+    case t_input::BDSEph:
+      pppRun->slotNewBDSEph(*static_cast<const t_ephBDS*>(input._eph.data()));
+      break;
+    case t_input::Tec:
+      pppRun->slotNewTec(*input._vTec);
+      break;
+    case t_input::OrbCorr:
+      pppRun->slotNewOrbCorrections(input._orbCorr);
+      break;
+    case t_input::ClkCorr:
+      pppRun->slotNewClkCorrections(input._clkCorr);
+      break;
+    case t_input::CodeBias:
+      pppRun->slotNewCodeBiases(input._codeBiases);
+      break;
+    case t_input::PhaseBias:
+      pppRun->slotNewPhaseBiases(input._phaseBiases);
+      break;
+    case t_input::ProviderID:
+      pppRun->slotProviderIDChanged(input._mountPoint);
+      break;
+    }
+  }
+}
+
+// Process all queued epochs of a station (called in a worker thread)
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::process(t_station* station) {
+
+  while (true) {
+    QList<QPair<t_satObsBatchPtr, qint64> > obsBatches;
+    try {
+      applyInput(station);
+
+      {
+        QMutexLocker locker(&station->_mutex);
+        if (station->_obsBatches.isEmpty()) {
+          station->_scheduled = false;
+          return;
+        }
+        obsBatches = station->_obsBatches;
+        station->_obsBatches.clear();
+      }
+
+      for (int ii = 0; ii < obsBatches.size(); ii++) {
+        station->_pppRun->slotNewObs(obsBatches[ii].first);
+        double msec = _clock.elapsed() - obsBatches[ii].second;
+        QMutexLocker locker(&station->_mutex);
+        station->_latency.add(msec);
+      }
+    }
+    catch (t_except exc) {
+      emit newMessage(QByteArray(exc.what().c_str()), true);
+    }
+  }
+}
+
+// Latency histograms of all stations
+////////////////////////////////////////////////////////////////////////////
+QByteArray t_pppScheduler::latencyReport() {
+  QString report;
+  QMapIterator<QByteArray, t_station*> it(_stations);
+  while (it.hasNext()) {
+    it.next();
+    t_station* station = it.value();
+    QMutexLocker locker(&station->_mutex);
+    report += "pppScheduler " + QString(station->_staID) + ": latency "
+            + station->_latency.toString() + "\n";
+  }
+  return report.toLatin1();
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::slotReport() {
+  emit newMessage(latencyReport(), false);
+}
+
+//
+////////////////////////////////////////////////////////////////////////////
+void t_pppScheduler::t_latency::add(double msec) {
+  int iBin = 0;
+  while (iBin < NUMBIN-1 && msec > _upper[iBin]) {
+    ++iBin;
+  }
+  ++_count[iBin];
+  ++_num;
+  if (msec > _max) {
+    _max = msec;
+  }
+}
+
+// Number of batches, maximum and counts per bin ("<=limit:count")
+////////////////////////////////////////////////////////////////////////////
+QString t_pppScheduler::t_latency::toString() const {
+  QString str = QString("n %1 max %2 ms ").arg(_num).arg(_max, 0, 'f', 1);
+  for (int iBin = 0; iBin < NUMBIN; iBin++) {
+    if (iBin < NUMBIN-1) {
+      str += QString(" <=%1:%2").arg(_upper[iBin]).arg(_count[iBin]);
+    }
+    else {
+      str += QString(" >%1:%2").arg(_upper[NUMBIN-2]).arg(_count[iBin]);
+    }
+  }
+  return str;
+}
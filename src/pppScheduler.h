@@ -0,0 +1,155 @@
+// Part of BNC, a utility for retrieving decoding and
+// converting GNSS data streams from NTRIP broadcasters.
+//
+// Copyright (C) 2007
+// German Federal Agency for Cartography and Geodesy (BKG)
+// http://www.bkg.bund.de
+// Czech Technical University Prague, Department of Geodesy
+// http://www.fsv.cvut.cz
+//
+// Email: euref-ip@bkg.bund.de
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation, version 2.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+
+#ifndef PPPSCHEDULER_H
+#define PPPSCHEDULER_H
+
+#include <deque>
+#include <QtCore>
+
+#include "ephemeris.h"
+#include "satObs.h"
+#include "pppOptions.h"
+
+namespace BNC_PPP {
+
+class t_pppRun;
+
+// Runs all real-time PPP clients as tasks on a fixed pool of worker
+// threads. Ephemerides, corrections and biases are received once and kept
+// in a common input queue; each station consumes it when its next epoch is
+// processed. The queue is trimmed by age; a station that has fallen behind
+// gets the latest ephemeris per satellite, biases, VTEC and provider ID
+// changes from a snapshot instead of the dropped messages. A station is
+// processed by at most one worker at a time.
+class t_pppScheduler : public QObject {
+ Q_OBJECT
+ public:
+  t_pppScheduler(const QList<t_pppOptions*>& options, int numWorkers);
+  ~t_pppScheduler();
+
+  QByteArray latencyReport();
+
+ signals:
+  void newMessage(QByteArray msg, bool showOnScreen);
+
+ private slots:
+  void slotNewGPSEph(t_ephGPS eph);
+  void slotNewGlonassEph(t_ephGlo eph);
+  void slotNewGalileoEph(t_ephGal eph);
+  void slotNewBDSEph(t_ephBDS eph);
+  void slotNewTec(t_vTec vTec);
+  void slotNewOrbCorrections(QList<t_orbCorr> orbCorr);
+  void slotNewClkCorrections(QList<t_clkCorr> clkCorr);
+  void slotNewCodeBiases(QList<t_satCodeBias> codeBiases);
+  void slotNewPhaseBiases(QList<t_satPhaseBias> phaseBiases);
+  void slotNewObs(t_satObsBatchPtr obsBatch);
+  void slotProviderIDChanged(QString mountPoint);
+  void slotReport();
+
+ private:
+  // Input shared by all stations (one entry per received message)
+  class t_input {
+   public:
+    enum e_type {GPSEph, GlonassEph, GalileoEph, BDSEph, Tec, OrbCorr,
+                 ClkCorr, CodeBias, PhaseBias, ProviderID};
+    t_input(e_type type) {_type = type; _time = 0;}
+    e_type                 _type;
+    qint64                 _time;  // arrival [ms]
+    QSharedPointer<t_eph>  _eph;
+    QSharedPointer<t_vTec> _vTec;
+    QList<t_orbCorr>       _orbCorr;
+    QList<t_clkCorr>       _clkCorr;
+    QList<t_satCodeBias>   _codeBiases;
+    QList<t_satPhaseBias>  _phaseBiases;
+    QString                _mountPoint;
+  };
+
+  // Histogram of the time between arrival and end of processing of
+  // an observation batch
+  class t_latency {
+   public:
+    enum {NUMBIN = 12};
+    t_latency() {
+      for (int ii = 0; ii < NUMBIN; ii++) {
+        _count[ii] = 0;
+      }
+      _num = 0;
+      _max = 0.0;
+    }
+    void    add(double msec);
+    QString toString() const;
+    static const double _upper[NUMBIN-1];  // upper bin limits [ms]
+    unsigned long _count[NUMBIN];
+    unsigned long _num;
+    double        _max;
+  };
+
+  class t_station {
+   public:
+    t_station() {
+      _pppRun    = 0;
+      _scheduled = false;
+      _nextInput = 0;
+    }
+    QByteArray                              _staID;
+    t_pppRun*                               _pppRun;
+    QMutex                                  _mutex;
+    QList<QPair<t_satObsBatchPtr, qint64> > _obsBatches;  // with arrival [ms]
+    bool                                    _scheduled;
+    qint64                                  _nextInput;
+    t_latency                               _latency;
+  };
+
+  class t_task : public QRunnable {
+   public:
+    t_task(t_pppScheduler* scheduler, t_station* station) {
+      _scheduler = scheduler;
+      _station   = station;
+    }
+    virtual void run() {_scheduler->process(_station);}
+   private:
+    t_pppScheduler* _scheduler;
+    t_station*      _station;
+  };
+
+  void putInput(t_input& input);
+  void putSnapshot(const QString& key, qint64 seq, const t_input& input);
+  void applyInput(t_station* station);
+  void process(t_station* station);
+
+  QThreadPool                    _pool;
+  QElapsedTimer                  _clock;
+  QTimer*                        _reportTimer;
+  QMutex                         _inputMutex;
+  std::deque<t_input>            _inputs;
+  qint64                         _firstInput;  // sequence number of _inputs.front()
+  QMap<QString, QPair<qint64, t_input> > _snapshot; // latest input per key with its sequence number
+  QMap<QByteArray, t_station*>   _stations;
+};
+
+}
+
+#endif
@@ -39,6 +39,7 @@ class t_corrFile : public QObject {
   ~t_corrFile();
   void syncRead(const bncTime& tt);
   const QMap<QString, unsigned int>& corrIODs() const {return _corrIODs;}
+  const bncTime& lastEpoTime() const {return _lastEpoTime;}
 
  signals:
   void newOrbCorrections(QList<t_orbCorr>);
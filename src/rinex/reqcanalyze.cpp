@@ -39,6 +39,7 @@
 #include "eleplot.h"
 #include "dopplot.h"
 #include "bncephuser.h"
+#include "bncsatstatecache.h"
 
 using namespace std;
 using namespace NEWMAT;
@@ -276,7 +277,7 @@ double t_reqcAnalyze::cmpDOP(const ColumnVector& xyzSta) const {
     if (eph) {
       ColumnVector xSat(4);
       ColumnVector vv(3);
-      if (eph->getCrd(_currEpo->tt, xSat, vv, false) == success) {
+      if (bncSatStateCache::instance()->getCrd(eph, _currEpo->tt, xSat, vv, false) == success) {
         ++nSatUsed;
         ColumnVector dx = xSat.Rows(1,3) - xyzSta;
         double rho = dx.NormFrobenius();
@@ -340,7 +341,7 @@ void t_reqcAnalyze::setQcObs(const bncTime& epoTime, const ColumnVector& xyzSta,
     ColumnVector xc(4);
     ColumnVector vv(3);
     if ( xyzSta.Ncols() == 3 && (xyzSta.NormFrobenius() != 0.0) &&
-         eph->getCrd(epoTime, xc, vv, false) == success) {
+         bncSatStateCache::instance()->getCrd(eph, epoTime, xc, vv, false) == success) {
       double rho, eleSat, azSat;
       topos(xyzSta(1), xyzSta(2), xyzSta(3), xc(1), xc(2), xc(3), rho, eleSat, azSat);
       qcSat._eleSet = true;
@@ -356,7 +357,7 @@ void t_reqcAnalyze::setQcObs(const bncTime& epoTime, const ColumnVector& xyzSta,
   // Availability and Slip Flags
   // ---------------------------
   for (unsigned ii = 0; ii < satObs._obs.size(); ii++) {
-    const t_frqObs* frqObs = satObs._obs[ii];
+    const t_frqObs* frqObs = &satObs._obs[ii];
 
     qcSat._qcFrq.push_back(t_qcFrq());
     t_qcFrq& qcFrq = qcSat._qcFrq.back();
@@ -408,7 +409,7 @@ void t_reqcAnalyze::setQcObs(const bncTime& epoTime, const ColumnVector& xyzSta,
         bool   foundB = false;
         double L_b    = 0.0;
         for (unsigned jj = 0; jj < satObs._obs.size(); jj++) {
-          const t_frqObs* frqObsHlp = satObs._obs[jj];
+          const t_frqObs* frqObsHlp = &satObs._obs[jj];
           if      (frqObsHlp->_rnxType2ch[0] == t_frequency::toString(fA)[1] &&
               frqObsHlp->_phaseValid) {
             foundA = true;
@@ -1090,7 +1091,7 @@ void t_reqcAnalyze::setExpectedObs(const bncTime& startTime, const bncTime& endT
         ColumnVector xc(4);
         ColumnVector vv(3);
         if ( xyzSta.Nrows() == 3 && (xyzSta.NormFrobenius() != 0.0) &&
-             eph->getCrd(epoTime, xc, vv, false) == success) {
+             bncSatStateCache::instance()->getCrd(eph, epoTime, xc, vv, false) == success) {
           double rho, eleSat, azSat;
           topos(xyzSta(1), xyzSta(2), xyzSta(3), xc(1), xc(2), xc(3), rho, eleSat, azSat);
           if ((eleSat * 180.0/M_PI) > 0.0) {
@@ -39,7 +39,11 @@
  * -----------------------------------------------------------------------*/
 
 #include <iostream>
+#include <algorithm>
+#include <functional>
 #include <newmat/newmatio.h>
+#include <QThreadPool>
+#include <QRunnable>
 #include "rnxnavfile.h"
 #include "bnccore.h"
 #include "bncutils.h"
@@ -47,6 +51,62 @@
 
 using namespace std;
 
+// Number of navigation records parsed by one task
+////////////////////////////////////////////////////////////////////////////
+static const int PARSE_BLOCK = 1024;
+
+// Lines of one navigation record
+////////////////////////////////////////////////////////////////////////////
+class t_rnxNavRecord {
+ public:
+  QChar       _system;
+  QStringList _lines;
+};
+
+// Parsing of a block of navigation records
+////////////////////////////////////////////////////////////////////////////
+class t_parseTask : public QRunnable {
+ public:
+  t_parseTask(double version, const QVector<t_rnxNavRecord>& records,
+              int iBeg, int iEnd, vector<t_eph*>& ephs) :
+    _version(version), _records(records), _iBeg(iBeg), _iEnd(iEnd), _ephs(ephs) {}
+
+  virtual void run() {
+    for (int ii = _iBeg; ii < _iEnd; ii++) {
+      const t_rnxNavRecord& rec = _records[ii];
+      t_eph* eph = 0;
+      if      (rec._system == 'G' || rec._system == 'J') {
+        eph = new t_ephGPS(_version, rec._lines);
+      }
+      else if (rec._system == 'R') {
+        eph = new t_ephGlo(_version, rec._lines);
+      }
+      else if (rec._system == 'E') {
+        eph = new t_ephGal(_version, rec._lines);
+      }
+      else if (rec._system == 'S') {
+        eph = new t_ephSBAS(_version, rec._lines);
+      }
+      else if (rec._system == 'C') {
+        eph = new t_ephBDS(_version, rec._lines);
+      }
+      if (eph &&
+          (eph->checkState() == t_eph::bad ||
+           eph->checkState() == t_eph::outdated)) {
+        delete eph; eph = 0;
+      }
+      _ephs[ii] = eph;
+    }
+  }
+
+ private:
+  double                        _version;
+  const QVector<t_rnxNavRecord>& _records;
+  int                           _iBeg;
+  int                           _iEnd;
+  vector<t_eph*>&               _ephs;
+};
+
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
 t_rnxNavFile::t_rnxNavHeader::t_rnxNavHeader() {
@@ -90,9 +150,10 @@ t_irc t_rnxNavFile::t_rnxNavHeader::read(QTextStream* stream) {
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
 t_rnxNavFile::t_rnxNavFile(const QString& fileName, e_inpOut inpOut) {
-  _inpOut = inpOut;
-  _stream = 0;
-  _file   = 0;
+  _inpOut   = inpOut;
+  _stream   = 0;
+  _file     = 0;
+  _ephIndex = 0;
   if (_inpOut == input) {
     openRead(fileName);
   }
@@ -130,6 +191,7 @@ void t_rnxNavFile::openWrite(const QString& fileName) {
 ////////////////////////////////////////////////////////////////////////////
 t_rnxNavFile::~t_rnxNavFile() {
   close();
+  delete _ephIndex;
   for (unsigned ii = 0; ii < _ephs.size(); ii++) {
     delete _ephs[ii];
   }
@@ -143,9 +205,14 @@ void t_rnxNavFile::close() {
 }
 
 // Read File Content
+//
+// The lines of the records are read sequentially, the records are then
+// parsed in parallel in blocks of PARSE_BLOCK records.
 ////////////////////////////////////////////////////////////////////////////
 void t_rnxNavFile::read(QTextStream* stream) {
 
+  QVector<t_rnxNavRecord> records;
+
   while (stream->status() == QTextStream::Ok && !stream->atEnd()) {
     QString line = stream->readLine();
     if (line.isEmpty()) {
@@ -165,51 +232,43 @@ void t_rnxNavFile::read(QTextStream* stream) {
       }
     }
 
-    t_eph* eph = 0;
-    QStringList lines; lines << line;
-    if      (prn[0] == 'G') {
-      for (int ii = 1; ii < 8; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephGPS(version(), lines);
-    }
-    else if (prn[0] == 'R') {
-      for (int ii = 1; ii < 4; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephGlo(version(), lines);
+    int nLines = 0;
+    if      (prn[0] == 'G' || prn[0] == 'E' || prn[0] == 'J' || prn[0] == 'C') {
+      nLines = 8;
     }
-    else if (prn[0] == 'E') {
-      for (int ii = 1; ii < 8; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephGal(version(), lines);
-    }
-    else if (prn[0] == 'J') {
-      for (int ii = 1; ii < 8; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephGPS(version(), lines);
+    else if (prn[0] == 'R' || prn[0] == 'S') {
+      nLines = 4;
     }
-    else if (prn[0] == 'S') {
-      for (int ii = 1; ii < 4; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephSBAS(version(), lines);
+    else {
+      continue;
     }
-    else if (prn[0] == 'C') {
-      for (int ii = 1; ii < 8; ii++) {
-        lines << stream->readLine();
-      }
-      eph = new t_ephBDS(version(), lines);
+
+    t_rnxNavRecord rec;
+    rec._system = prn[0];
+    rec._lines << line;
+    for (int ii = 1; ii < nLines; ii++) {
+      rec._lines << stream->readLine();
     }
-    if (eph &&
-        eph->checkState() != t_eph::bad &&
-        eph->checkState() != t_eph::outdated) {
-      _ephs.push_back(eph);
+    records.push_back(rec);
+  }
+
+  vector<t_eph*> ephs(records.size(), (t_eph*)(0));
+  if (records.size() <= PARSE_BLOCK) {
+    t_parseTask task(version(), records, 0, records.size(), ephs);
+    task.run();
+  }
+  else {
+    QThreadPool pool;
+    for (int iBeg = 0; iBeg < records.size(); iBeg += PARSE_BLOCK) {
+      int iEnd = qMin(iBeg + PARSE_BLOCK, records.size());
+      pool.start(new t_parseTask(version(), records, iBeg, iEnd, ephs));
     }
-    else {
-      delete eph;
+    pool.waitForDone();
+  }
+
+  for (unsigned ii = 0; ii < ephs.size(); ii++) {
+    if (ephs[ii]) {
+      _ephs.push_back(ephs[ii]);
     }
   }
 }
@@ -219,43 +278,110 @@ void t_rnxNavFile::read(QTextStream* stream) {
 t_eph* t_rnxNavFile::getNextEph(const bncTime& tt,
                                 const QMap<QString, unsigned int>* corrIODs) {
 
+  if (!_ephIndex) {
+    _ephIndex = new t_ephIndex(_ephs);
+  }
+
+  int index = _ephIndex->next(tt, corrIODs);
+  if (index < 0) {
+    return 0;
+  }
+
+  t_eph* eph = _ephs[index];
+  _ephs[index] = 0;
+  return eph;
+}
+
+// Ephemerides not yet released by getNextEph
+////////////////////////////////////////////////////////////////////////////
+const vector<t_eph*> t_rnxNavFile::ephs() const {
+  if (!_ephIndex) {
+    return _ephs;
+  }
+  vector<t_eph*> ephs;
+  for (unsigned ii = 0; ii < _ephs.size(); ii++) {
+    if (_ephs[ii]) {
+      ephs.push_back(_ephs[ii]);
+    }
+  }
+  return ephs;
+}
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_rnxNavFile::t_ephIndex::t_ephIndex(const vector<t_eph*>& ephs) {
+
+  _cursor = 0;
+  _released.resize(ephs.size(), false);
+  _toc.resize(ephs.size());
+  _byToc.resize(ephs.size());
+  for (unsigned ii = 0; ii < ephs.size(); ii++) {
+    const t_eph* eph = ephs[ii];
+    _toc[ii]   = eph->TOC();
+    _byToc[ii] = make_pair(_toc[ii], int(ii));
+    _byIOD[QString(eph->prn().toInternalString().c_str())][eph->IOD()].push_back(ii);
+  }
+  sort(_byToc.begin(), _byToc.end());
+}
+
+// Destructor
+////////////////////////////////////////////////////////////////////////////
+t_rnxNavFile::t_ephIndex::~t_ephIndex() {
+}
+
+// Index of the next ephemeris to be used at time tt (-1 if none), each
+// record is released only once
+////////////////////////////////////////////////////////////////////////////
+int t_rnxNavFile::t_ephIndex::next(const bncTime& tt,
+                                   const QMap<QString, unsigned int>* corrIODs) {
+
   // Get Ephemeris according to IOD
   // ------------------------------
   if (corrIODs) {
     QMapIterator<QString, unsigned int> itIOD(*corrIODs);
     while (itIOD.hasNext()) {
       itIOD.next();
-      QString prn = itIOD.key();
-      unsigned int iod = itIOD.value();
-      vector<t_eph*>::iterator it = _ephs.begin();
-      while (it != _ephs.end()) {
-        t_eph* eph = *it;
-        double dt = eph->TOC() - tt;
-        if (dt < 8*3600.0 && QString(eph->prn().toInternalString().c_str()) == prn && eph->IOD() == iod) {
-          it = _ephs.erase(it);
-          return eph;
+      QMap<QString, QMap<unsigned int, QVector<int> > >::iterator itPrn =
+        _byIOD.find(itIOD.key());
+      if (itPrn == _byIOD.end()) {
+        continue;
+      }
+      QMap<unsigned int, QVector<int> >::iterator itRec = itPrn->find(itIOD.value());
+      if (itRec == itPrn->end()) {
+        continue;
+      }
+      QVector<int>& recs = itRec.value();
+      for (int ii = 0; ii < recs.size(); ii++) {
+        int index = recs[ii];
+        if (_released[index]) {
+          recs.remove(ii--);
+        }
+        else if (_toc[index] - tt < 8*3600.0) {
+          _released[index] = true;
+          recs.remove(ii);
+          return index;
         }
-        ++it;
       }
     }
   }
 
-  // Get Ephemeris according to time
-  // -------------------------------
+  // Get Ephemeris according to time (in file order)
+  // ------------------------------------------------
   else {
-    vector<t_eph*>::iterator it = _ephs.begin();
-    while (it != _ephs.end()) {
-      t_eph* eph = *it;
-      double dt = eph->TOC() - tt;
-      if (dt < 2*3600.0) {
-        it = _ephs.erase(it);
-        return eph;
+    while (_cursor < _byToc.size() && _byToc[_cursor].first - tt < 2*3600.0) {
+      _pending.push(_byToc[_cursor++].second);
+    }
+    while (!_pending.empty()) {
+      int index = _pending.top();
+      _pending.pop();
+      if (!_released[index]) {
+        _released[index] = true;
+        return index;
       }
-      ++it;
     }
   }
 
-  return 0;
+  return -1;
 }
 
 //
@@ -26,6 +26,8 @@
 #define RNXNAVFILE_H
 
 #include <queue>
+#include <vector>
+#include <functional>
 #include <QtCore>
 #include "bncconst.h"
 #include "bnctime.h"
@@ -53,10 +55,28 @@ class t_rnxNavFile {
   };
  
  public:
+  // Release order of a list of ephemerides (selection rule of getNextEph):
+  // records sorted by TOC with a cursor for the release by time and per
+  // PRN a map IOD -> records for the release by IOD. The list is not owned.
+  class t_ephIndex {
+   public:
+    t_ephIndex(const std::vector<t_eph*>& ephs);
+    ~t_ephIndex();
+    int next(const bncTime& tt, const QMap<QString, unsigned int>* corrIODs);
+   private:
+    std::vector<bncTime>                              _toc;
+    std::vector<bool>                                 _released;
+    std::vector<std::pair<bncTime, int> >             _byToc;
+    unsigned                                          _cursor;
+    std::priority_queue<int, std::vector<int>,
+                        std::greater<int> >           _pending;
+    QMap<QString, QMap<unsigned int, QVector<int> > > _byIOD;
+  };
+
   t_rnxNavFile(const QString& fileName, e_inpOut inpOut);
   ~t_rnxNavFile();
   t_eph* getNextEph(const bncTime& tt, const QMap<QString, unsigned int>* corrIODs);
-  const std::vector<t_eph*> ephs() const {return _ephs;}
+  const std::vector<t_eph*> ephs() const;
   double version() const {return _header._version;}
   void   setVersion(double version) {_header._version = version;}
   bool   glonass() const {return _header._glonass;}
@@ -66,7 +86,7 @@ class t_rnxNavFile {
   void   writeEph(const t_eph* eph);
 
  protected:
-  t_rnxNavFile() {};
+  t_rnxNavFile() {_ephIndex = 0;};
   void openRead(const QString& fileName);
   void openWrite(const QString& fileName);
   void close();
@@ -79,6 +99,7 @@ class t_rnxNavFile {
   QString             _fileName;
   QTextStream*        _stream;
   std::vector<t_eph*> _ephs;
+  t_ephIndex*         _ephIndex;
   t_rnxNavHeader      _header;
 };
 
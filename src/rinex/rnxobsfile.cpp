@@ -1493,19 +1493,14 @@ void t_rnxObsFile::setObsFromRnx(const t_rnxObsFile* rnxObsFile, const t_rnxObsF
     if (rnxSat.obs.contains(type)) {
       const t_rnxObs& rnxObs = rnxSat.obs[type];
       if (rnxObs.value != 0.0) {
-        string type2ch(typeV3.mid(1).toLatin1().data());
+        t_rnxType2ch type2ch(typeV3.mid(1).toLatin1().data());
 
-        t_frqObs* frqObs = 0;
-        for (unsigned iFrq = 0; iFrq < obs._obs.size(); iFrq++) {
-          if (obs._obs[iFrq]->_rnxType2ch == type2ch) {
-            frqObs = obs._obs[iFrq];
-            break;
-          }
-        }
+        t_frqObs* frqObs = obs._obs.find(type2ch);
         if (frqObs == 0) {
-          frqObs = new t_frqObs;
-          frqObs->_rnxType2ch = type2ch;
-          obs._obs.push_back(frqObs);
+          frqObs = obs._obs.append(type2ch);
+          if (frqObs == 0) {
+            continue;
+          }
         }
 
         switch( typeV3.toLatin1().data()[0] ) {
@@ -7,6 +7,29 @@
 
 using namespace std;
 
+// Observation copies made while publishing, see t_satObsBatch
+////////////////////////////////////////////////////////////////////////////
+static QAtomicInteger<qint64> satObsBytesCopied(0);
+
+// Constructor
+////////////////////////////////////////////////////////////////////////////
+t_satObsBatch::t_satObsBatch(const QByteArray& staID, const QList<t_satObs>& obsList) {
+  _staID   = staID;
+  _obsList = obsList;
+}
+
+// 
+////////////////////////////////////////////////////////////////////////////
+void t_satObsBatch::addBytesCopied(qint64 nBytes) {
+  satObsBytesCopied.fetchAndAddRelaxed(nBytes);
+}
+
+// 
+////////////////////////////////////////////////////////////////////////////
+qint64 t_satObsBatch::bytesCopied() {
+  return satObsBytesCopied.load();
+}
+
 // Constructor
 ////////////////////////////////////////////////////////////////////////////
 t_clkCorr::t_clkCorr() {
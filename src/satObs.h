@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <newmat/newmat.h>
 
 #include <QtCore>
@@ -11,6 +12,41 @@
 #include "bnctime.h"
 #include "t_prn.h"
 
+// Two-character RINEX signal code (e.g. "1C") stored inline
+////////////////////////////////////////////////////////////////////////////
+class t_rnxType2ch {
+ public:
+  t_rnxType2ch() {
+    _c[0] = _c[1] = _c[2] = '\0';
+  }
+  t_rnxType2ch(const char* str) {
+    assign(str);
+  }
+  t_rnxType2ch(const std::string& str) {
+    assign(str.c_str());
+  }
+  void assign(const char* str) {
+    _c[0] = (str && str[0]) ? str[0] : '\0';
+    _c[1] = (_c[0]   && str[1]) ? str[1] : '\0';
+    _c[2] = '\0';
+  }
+  void assign(const std::string& str) {
+    assign(str.c_str());
+  }
+  bool        empty() const            {return _c[0] == '\0';}
+  const char* c_str() const            {return _c;}
+  std::string toString() const         {return std::string(_c);}
+  char        operator[](int ii) const {return _c[ii];}
+  bool operator==(const t_rnxType2ch& other) const {
+    return _c[0] == other._c[0] && _c[1] == other._c[1];
+  }
+  bool operator!=(const t_rnxType2ch& other) const {
+    return !operator==(other);
+  }
+ private:
+  char _c[3];
+};
+
 class t_frqObs  {
  public:
   t_frqObs() {
@@ -26,48 +62,100 @@ class t_frqObs  {
     _slipCounter     = 0;
     _biasJumpCounter = 0;
   }
-  std::string       _rnxType2ch;
   double            _code;
-  bool              _codeValid;
   double            _phase;
-  bool              _phaseValid;
   double            _doppler;
-  bool              _dopplerValid;
   double            _snr;
-  bool              _snrValid;
-  bool              _slip;
   int               _slipCounter;
   int               _biasJumpCounter;
+  t_rnxType2ch      _rnxType2ch;
+  bool              _codeValid;
+  bool              _phaseValid;
+  bool              _dopplerValid;
+  bool              _snrValid;
+  bool              _slip;
 };
 
-class t_satObs {
+// Fixed-capacity list of frequency observations stored inline (no heap
+// allocation when satellite observations are created or copied)
+////////////////////////////////////////////////////////////////////////////
+class t_frqObsList {
  public:
-  t_satObs() {}
-  t_satObs(const t_satObs& old) { // copy constructor (deep copy)
-    _staID = old._staID;
-    _prn   = old._prn;
-    _time  = old._time;
-    for (unsigned ii = 0; ii < old._obs.size(); ii++) {
-      _obs.push_back(new t_frqObs(*old._obs[ii]));
+  static const unsigned MAXSIZE = 24;
+
+  t_frqObsList() {
+    _size = 0;
+  }
+  t_frqObsList(const t_frqObsList& old) {
+    _size = old._size;
+    std::copy(old._obs, old._obs + old._size, _obs);
+  }
+  t_frqObsList& operator=(const t_frqObsList& old) {
+    _size = old._size;
+    std::copy(old._obs, old._obs + old._size, _obs);
+    return *this;
+  }
+
+  unsigned        size() const  {return _size;}
+  bool            empty() const {return _size == 0;}
+  bool            full() const  {return _size == MAXSIZE;}
+  void            clear()       {_size = 0;}
+  t_frqObs&       operator[](unsigned ii)       {return _obs[ii];}
+  const t_frqObs& operator[](unsigned ii) const {return _obs[ii];}
+
+  /**
+   * Append a new (default) observation for the given signal code.
+   * @return pointer to the new slot or 0 if the list is full
+   */
+  t_frqObs* append(const t_rnxType2ch& rnxType2ch) {
+    if (_size == MAXSIZE) {
+      return 0;
     }
+    t_frqObs* frqObs = &_obs[_size++];
+    *frqObs = t_frqObs();
+    frqObs->_rnxType2ch = rnxType2ch;
+    return frqObs;
   }
+
   /**
-   * Destructor of satellite measurement storage class
+   * Find the observation of the given signal code.
+   * @return pointer to the slot or 0 if not present
    */
-  ~t_satObs()
-  {
-    clear();
+  t_frqObs* find(const t_rnxType2ch& rnxType2ch) {
+    for (unsigned ii = 0; ii < _size; ii++) {
+      if (_obs[ii]._rnxType2ch == rnxType2ch) {
+        return &_obs[ii];
+      }
+    }
+    return 0;
+  }
+  const t_frqObs* find(const t_rnxType2ch& rnxType2ch) const {
+    return const_cast<t_frqObsList*>(this)->find(rnxType2ch);
   }
 
+ private:
+  unsigned _size;
+  t_frqObs _obs[MAXSIZE];
+};
+
+class t_satObs {
+ public:
+  t_satObs() {}
+  t_satObs(const t_satObs& old)            = default;
+  t_satObs(t_satObs&& old)                 = default;
+  t_satObs& operator=(const t_satObs& old) = default;
+  t_satObs& operator=(t_satObs&& old)      = default;
+  /**
+   * Destructor of satellite measurement storage class
+   */
+  ~t_satObs() {}
+
   /**
    * Cleanup function resets all elements to initial state.
    */
   inline void clear(void)
   {
-    for (unsigned ii = 0; ii < _obs.size(); ii++)
-      delete _obs[ii];
     _obs.clear();
-    _obs.resize(0);
     _time.reset();
     _prn.clear();
     _staID.clear();
@@ -76,9 +164,25 @@ class t_satObs {
   std::string            _staID;
   t_prn                  _prn;
   bncTime                _time;
-  std::vector<t_frqObs*> _obs;
+  t_frqObsList           _obs;
+};
+
+// Observations of one station decoded together (one or several epochs),
+// published once and shared read-only by all consumers. Deep copies of
+// t_satObs made on the way from the decoder to the consumers are counted
+// in bytesCopied().
+////////////////////////////////////////////////////////////////////////////
+class t_satObsBatch {
+ public:
+  t_satObsBatch(const QByteArray& staID, const QList<t_satObs>& obsList);
+  static void   addBytesCopied(qint64 nBytes);
+  static qint64 bytesCopied();
+  QByteArray      _staID;
+  QList<t_satObs> _obsList;
 };
 
+typedef QSharedPointer<const t_satObsBatch> t_satObsBatchPtr;
+
 class t_orbCorr {
  public:
   t_orbCorr();
@@ -37,6 +37,7 @@ win32:LIBS += -L../newmat/release -L../qwt/release -L../qwtpolar/release \
 
 HEADERS = bnchelp.html bncgetthread.h    bncwindow.h   bnctabledlg.h  \
           bnccaster.h bncrinex.h bnccore.h bncutils.h   bnchlpdlg.h   \
+          bnccasterclient.h                                           \
           bncconst.h bnchtml.h bnctableitem.h bnczerodecoder.h        \
           bncnetquery.h bncnetqueryv1.h bncnetqueryv2.h               \
           bncnetqueryrtp.h bncsettings.h latencychecker.h             \
@@ -50,14 +51,18 @@ HEADERS = bnchelp.html bncgetthread.h    bncwindow.h   bnctabledlg.h  \
           bncbytescounter.h bncsslconfig.h reqcdlg.h                  \
           upload/bncrtnetdecoder.h upload/bncuploadcaster.h           \
           ephemeris.h t_prn.h satObs.h                                \
+          bncsatstatecache.h                                          \
+          bncgpstime.h                                                \
           upload/bncrtnetuploadcaster.h upload/bnccustomtrafo.h       \
           upload/bncephuploadcaster.h qtfilechooser.h                 \
           GPSDecoder.h pppInclude.h pppWidgets.h pppModel.h           \
           pppMain.h pppRun.h pppOptions.h pppCrdFile.h pppThread.h    \
+          pppScheduler.h pppBatch.h                                   \
           RTCM/RTCM2.h RTCM/RTCM2Decoder.h                            \
           RTCM/RTCM2_2021.h RTCM/rtcm_utils.h                         \
           RTCM3/RTCM3Decoder.h RTCM3/bits.h RTCM3/gnss.h              \
           RTCM3/RTCM3coDecoder.h RTCM3/ephEncoder.h                   \
+          RTCM3/crc24q.h                                              \
           RTCM3/clock_and_orbit/clock_orbit_rtcm.h                    \
           rinex/rnxobsfile.h                                          \
           rinex/rnxnavfile.h       rinex/corrfile.h                   \
@@ -73,6 +78,7 @@ win32:HEADERS += serial/win_qextserialport.h
 
 SOURCES = bncgetthread.cpp  bncwindow.cpp bnctabledlg.cpp             \
           bnccaster.cpp bncrinex.cpp bnccore.cpp bncutils.cpp         \
+          bnccasterclient.cpp                                         \
           bncconst.cpp bnchtml.cpp bnchlpdlg.cpp bnctableitem.cpp     \
           bnczerodecoder.cpp bncnetqueryv1.cpp bncnetqueryv2.cpp      \
           bncnetqueryrtp.cpp bncsettings.cpp latencychecker.cpp       \
@@ -85,17 +91,20 @@ SOURCES = bncgetthread.cpp  bncwindow.cpp bnctabledlg.cpp             \
           bncoutf.cpp bncclockrinex.cpp bncsp3.cpp bncsinextro.cpp    \
           bncbytescounter.cpp bncsslconfig.cpp reqcdlg.cpp            \
           ephemeris.cpp t_prn.cpp satObs.cpp                          \
+          bncsatstatecache.cpp                                        \
+          bncgpstime.cpp                                              \
           upload/bncrtnetdecoder.cpp upload/bncuploadcaster.cpp       \
           upload/bncrtnetuploadcaster.cpp upload/bnccustomtrafo.cpp   \
           upload/bncephuploadcaster.cpp qtfilechooser.cpp             \
           GPSDecoder.cpp pppWidgets.cpp pppModel.cpp                  \
           pppMain.cpp pppRun.cpp pppOptions.cpp pppCrdFile.cpp        \
-          pppThread.cpp                                               \
+          pppThread.cpp pppScheduler.cpp pppBatch.cpp                 \
           RTCM/RTCM2.cpp RTCM/RTCM2Decoder.cpp                        \
           RTCM/RTCM2_2021.cpp RTCM/rtcm_utils.cpp                     \
           RTCM3/RTCM3Decoder.cpp                                      \
           RTCM3/RTCM3coDecoder.cpp RTCM3/ephEncoder.cpp               \
           RTCM3/clock_and_orbit/clock_orbit_rtcm.c                    \
+          RTCM3/crc24q.c                                              \
           rinex/rnxobsfile.cpp                                        \
           rinex/rnxnavfile.cpp     rinex/corrfile.cpp                 \
           rinex/reqcedit.cpp       rinex/reqcanalyze.cpp              \
@@ -125,8 +134,10 @@ exists(PPP) {
 else {
   INCLUDEPATH += PPP_SSR_I
   DEFINES += USE_PPP_SSR_I
-  HEADERS += PPP_SSR_I/pppClient.h   PPP_SSR_I/pppFilter.h   PPP_SSR_I/pppUtils.h
-  SOURCES += PPP_SSR_I/pppClient.cpp PPP_SSR_I/pppFilter.cpp PPP_SSR_I/pppUtils.cpp
+  HEADERS += PPP_SSR_I/pppClient.h   PPP_SSR_I/pppFilter.h   PPP_SSR_I/pppUtils.h   PPP_SSR_I/pppKalman.h   \
+             PPP_SSR_I/pppSmoother.h
+  SOURCES += PPP_SSR_I/pppClient.cpp PPP_SSR_I/pppFilter.cpp PPP_SSR_I/pppUtils.cpp PPP_SSR_I/pppKalman.cpp \
+             PPP_SSR_I/pppSmoother.cpp
 }
 
 # Check QtWebKit Library Existence
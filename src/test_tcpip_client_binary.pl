@@ -0,0 +1,100 @@
+#!/usr/bin/perl -w
+
+use strict;
+use IO::Socket;
+
+# Reads BNC's binary observation output (outFormat/outUFormat 'binary')
+# from the IP port and prints it in BNC's ASCII format
+# ----------------------------------------------------------------------
+
+# List of Parameters
+# ------------------
+my($port) = @ARGV;
+
+if (!defined($port)) {
+  die "Usage: test_tcpip_client_binary.pl portNumber\n";
+}
+
+# Local Variables
+# ---------------
+my($serverHostName) = "localhost";
+my $server;
+
+my $retries = 10;
+while ($retries--) {
+  $server = IO::Socket::INET->new( Proto    => "tcp",
+                                   PeerAddr => $serverHostName,
+                                   PeerPort => $port);
+  last if ($server);
+}
+die "Cannot connect to $serverHostName on $port: $!" unless ($server);
+binmode($server);
+
+# Read exactly n bytes
+# --------------------
+sub readBytes {
+  my($nBytes) = @_;
+  my $buffer = "";
+  while (length($buffer) < $nBytes) {
+    my $hlp;
+    my $nRead = read($server, $hlp, $nBytes - length($buffer));
+    return undef if (!$nRead);
+    $buffer .= $hlp;
+  }
+  return $buffer;
+}
+
+# Loop over records
+# -----------------
+while (defined(my $header = readBytes(8))) {
+  my($magic, $length) = unpack("a4 V", $header);
+  die "Wrong record marker\n" if ($magic ne "BNCO");
+  my $record = readBytes($length);
+  last if (!defined($record));
+
+  my $pos = 0;
+  my($week, $sec, $nSta) = unpack("l< d< v", $record);
+  $pos += 14;
+  printf("> %d %.7f\n", $week, $sec);
+
+  for (my $iSta = 0; $iSta < $nSta; $iSta++) {
+    my $idLen = unpack("C", substr($record, $pos, 1));
+    my $staID = substr($record, $pos + 1, $idLen);
+    my $nSat  = unpack("v", substr($record, $pos + 1 + $idLen, 2));
+    $pos += 3 + $idLen;
+
+    for (my $iSat = 0; $iSat < $nSat; $iSat++) {
+      my($sys, $num, $nSig) = unpack("a C C", substr($record, $pos, 3));
+      $pos += 3;
+      my $line = sprintf("%s %s%02d", $staID, $sys, $num);
+      for (my $iSig = 0; $iSig < $nSig; $iSig++) {
+        my($code, $flags) = unpack("a2 C", substr($record, $pos, 3));
+        $pos += 3;
+        my $slipCounter;
+        if ($flags & 2) {
+          $slipCounter = unpack("s<", substr($record, $pos, 2));
+          $pos += 2;
+        }
+        if ($flags & 1) {
+          $line .= sprintf(" C%s %14.3f", $code, unpack("d<", substr($record, $pos, 8)));
+          $pos += 8;
+        }
+        if ($flags & 2) {
+          $line .= sprintf(" L%s %14.3f %4d", $code, unpack("d<", substr($record, $pos, 8)),
+                           $slipCounter);
+          $pos += 8;
+        }
+        if ($flags & 4) {
+          $line .= sprintf(" D%s %14.3f", $code, unpack("d<", substr($record, $pos, 8)));
+          $pos += 8;
+        }
+        if ($flags & 8) {
+          $line .= sprintf(" S%s %8.3f", $code, unpack("d<", substr($record, $pos, 8)));
+          $pos += 8;
+        }
+      }
+      print "$line\n";
+    }
+  }
+  print "\n";
+}
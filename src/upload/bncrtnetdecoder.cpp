@@ -39,8 +39,11 @@
  * -----------------------------------------------------------------------*/
 
 #include <iostream>
+#include <math.h>
 #include "bncrtnetdecoder.h"
 #include "bncsettings.h"
+#include "bncephuser.h"
+#include "bncutils.h"
 
 using namespace std;
 
@@ -49,6 +52,26 @@ using namespace std;
 bncRtnetDecoder::bncRtnetDecoder() {
   bncSettings settings;
 
+  // Member that receives the ephemeris
+  // ----------------------------------
+  _ephUser = new bncEphUser(true);
+
+  QStringList hlp = settings.value("cmbStreams").toStringList();
+  _samplRtcmEphCorr = settings.value("uploadSamplRtcmEphCorr").toDouble();
+  if (hlp.size() > 1) { // combination stream upload
+    _samplRtcmClkCorr = settings.value("cmbSampl").toInt();
+  }
+  else { // single stream upload or sp3 file generation
+    _samplRtcmClkCorr = 5; // default
+  }
+
+  if (_samplRtcmEphCorr == 0.0) {
+    _usedEph = 0;
+  }
+  else {
+    _usedEph = new QMap<QString, const t_eph*>;
+  }
+
   // List of upload casters
   // ----------------------
   int iRow = -1;
@@ -88,15 +111,1918 @@ bncRtnetDecoder::~bncRtnetDecoder() {
   for (int ic = 0; ic < _casters.size(); ic++) {
     _casters[ic]->deleteSafely();
   }
+  delete _ephUser;
+  delete _usedEph;
 }
 
 // Decode Method
 //////////////////////////////////////////////////////////////////////// 
 t_irc bncRtnetDecoder::Decode(char* buffer, int bufLen, vector<string>& errmsg) {
   errmsg.clear();
+
+  // Append to internal buffer
+  // -------------------------
+  _rtnetStreamBuffer.append(QByteArray(buffer, bufLen));
+
+  // Select buffer part that contains last epoch
+  // -------------------------------------------
+  QStringList lines;
+  int iEpoBeg = _rtnetStreamBuffer.lastIndexOf('*');   // begin of last epoch
+  if (iEpoBeg == -1) {
+    _rtnetStreamBuffer.clear();
+    return success;
+  }
+  int iEpoBegEarlier = _rtnetStreamBuffer.indexOf('*');
+  if (iEpoBegEarlier != -1 && iEpoBegEarlier < iEpoBeg) { // are there two epoch lines in buffer?
+	  _rtnetStreamBuffer = _rtnetStreamBuffer.mid(iEpoBegEarlier);
+  }
+  else {
+    _rtnetStreamBuffer = _rtnetStreamBuffer.mid(iEpoBeg);
+  }
+
+  int iEpoEnd = _rtnetStreamBuffer.lastIndexOf("EOE"); // end   of last epoch
+  if (iEpoEnd == -1) {
+    return success;
+  }
+  else {
+    lines = _rtnetStreamBuffer.left(iEpoEnd).split('\n',
+        QString::SkipEmptyParts);
+    _rtnetStreamBuffer = _rtnetStreamBuffer.mid(iEpoEnd + 3);
+  }
+
+  if (lines.size() < 2 || _casters.isEmpty()) {
+    return success;
+  }
+
+  // Decode once, encode by each caster
+  // ----------------------------------
+  bncRtnetEpoch* epo = new bncRtnetEpoch;
+  decodeEpoch(lines, *epo);
   for (int ic = 0; ic < _casters.size(); ic++) {
-    _casters[ic]->decodeRtnetStream(buffer, bufLen);
+    _casters[ic]->processRtnetEpoch(*epo);
   }
+  delete epo;
+
   return success;
 }
 
+// Decode one RTNET epoch (all lines up to EOE)
+//////////////////////////////////////////////////////////////////////// 
+void bncRtnetDecoder::decodeEpoch(const QStringList& lines, bncRtnetEpoch& epo) {
+
+  // Read first line (with epoch time)
+  // ---------------------------------
+  QTextStream in(lines[0].toLatin1());
+  QString hlp;
+  int year, month, day, hour, min;
+  double sec;
+  in >> hlp >> year >> month >> day >> hour >> min >> sec;
+  bncTime& epoTime = epo._time;
+  epoTime.set(year, month, day, hour, min, sec);
+
+  struct ClockOrbit& co = epo._co;
+  memset(&co, 0, sizeof(co));
+  co.EpochTime[CLOCKORBIT_SATGPS] = static_cast<int>(epoTime.gpssec());
+  double gt = epoTime.gpssec() + 3 * 3600 - gnumleap(year, month, day);
+  co.EpochTime[CLOCKORBIT_SATGLONASS] = static_cast<int>(fmod(gt, 86400.0));
+  co.EpochTime[CLOCKORBIT_SATGALILEO] = static_cast<int>(epoTime.gpssec());
+  co.EpochTime[CLOCKORBIT_SATQZSS] = static_cast<int>(epoTime.gpssec());
+  co.EpochTime[CLOCKORBIT_SATSBAS] = static_cast<int>(epoTime.gpssec());
+  co.EpochTime[CLOCKORBIT_SATBDS] = static_cast<int>(epoTime.bdssec());
+  co.Supplied[COBOFS_CLOCK] = 1;
+  co.Supplied[COBOFS_ORBIT] = 1;
+  co.SatRefDatum = DATUM_ITRF;
+
+  struct CodeBias& bias = epo._bias;
+  memset(&bias, 0, sizeof(bias));
+  bias.EpochTime[CLOCKORBIT_SATGPS] = co.EpochTime[CLOCKORBIT_SATGPS];
+  bias.EpochTime[CLOCKORBIT_SATGLONASS] = co.EpochTime[CLOCKORBIT_SATGLONASS];
+  bias.EpochTime[CLOCKORBIT_SATGALILEO] = co.EpochTime[CLOCKORBIT_SATGALILEO];
+  bias.EpochTime[CLOCKORBIT_SATQZSS] = co.EpochTime[CLOCKORBIT_SATQZSS];
+  bias.EpochTime[CLOCKORBIT_SATSBAS] = co.EpochTime[CLOCKORBIT_SATSBAS];
+  bias.EpochTime[CLOCKORBIT_SATBDS] = co.EpochTime[CLOCKORBIT_SATBDS];
+
+  struct PhaseBias& phasebias = epo._phasebias;
+  memset(&phasebias, 0, sizeof(phasebias));
+  unsigned int dispersiveBiasConsistenyIndicator = 0;
+  unsigned int mwConsistencyIndicator = 0;
+  phasebias.EpochTime[CLOCKORBIT_SATGPS] = co.EpochTime[CLOCKORBIT_SATGPS];
+  phasebias.EpochTime[CLOCKORBIT_SATGLONASS] = co.EpochTime[CLOCKORBIT_SATGLONASS];
+  phasebias.EpochTime[CLOCKORBIT_SATGALILEO] = co.EpochTime[CLOCKORBIT_SATGALILEO];
+  phasebias.EpochTime[CLOCKORBIT_SATQZSS] = co.EpochTime[CLOCKORBIT_SATQZSS];
+  phasebias.EpochTime[CLOCKORBIT_SATSBAS] = co.EpochTime[CLOCKORBIT_SATSBAS];
+  phasebias.EpochTime[CLOCKORBIT_SATBDS] = co.EpochTime[CLOCKORBIT_SATBDS];
+
+  struct VTEC& vtec = epo._vtec;
+  memset(&vtec, 0, sizeof(vtec));
+  vtec.EpochTime = static_cast<int>(epoTime.gpssec());
+
+  // Default Update Interval
+  // -----------------------
+  int& clkUpdInd = epo._clkUpdInd;
+  int& ephUpdInd = epo._ephUpdInd;
+  clkUpdInd = 2;         // 5 sec
+  ephUpdInd = clkUpdInd; // default
+
+  if (_samplRtcmClkCorr > 5.0 && _samplRtcmEphCorr <= 5.0) { // combined orb and clock
+    ephUpdInd = determineUpdateInd(_samplRtcmClkCorr);
+  }
+  if (_samplRtcmClkCorr > 5.0) {
+    clkUpdInd = determineUpdateInd(_samplRtcmClkCorr);
+  }
+  if (_samplRtcmEphCorr > 5.0) {
+    ephUpdInd = determineUpdateInd(_samplRtcmEphCorr);
+  }
+
+  co.UpdateInterval = clkUpdInd;
+  bias.UpdateInterval = clkUpdInd;
+  phasebias.UpdateInterval = clkUpdInd;
+
+  for (int ii = 1; ii < lines.size(); ii++) {
+    QString key;  // prn or key VTEC, IND (phase bias indicators)
+    ColumnVector rtnAPC;
+    ColumnVector rtnVel;
+    ColumnVector rtnCoM;
+    double rtnClk;
+    t_prn prn;
+
+    QTextStream in(lines[ii].toLatin1());
+
+    in >> key;
+
+    // non-satellite specific parameters
+    if (key.contains("IND", Qt::CaseSensitive)) {
+      in >> dispersiveBiasConsistenyIndicator >> mwConsistencyIndicator;
+      continue;
+    }
+    // non-satellite specific parameters
+    if (key.contains("VTEC", Qt::CaseSensitive)) {
+      double ui;
+      in >> ui >> vtec.NumLayers;
+      vtec.UpdateInterval = (unsigned int) determineUpdateInd(ui);
+      for (unsigned ll = 0; ll < vtec.NumLayers; ll++) {
+        int dummy;
+        in >> dummy >> vtec.Layers[ll].Degree >> vtec.Layers[ll].Order
+            >> vtec.Layers[ll].Height;
+        for (unsigned iDeg = 0; iDeg <= vtec.Layers[ll].Degree; iDeg++) {
+          for (unsigned iOrd = 0; iOrd <= vtec.Layers[ll].Order; iOrd++) {
+            in >> vtec.Layers[ll].Cosinus[iDeg][iOrd];
+          }
+        }
+        for (unsigned iDeg = 0; iDeg <= vtec.Layers[ll].Degree; iDeg++) {
+          for (unsigned iOrd = 0; iOrd <= vtec.Layers[ll].Order; iOrd++) {
+            in >> vtec.Layers[ll].Sinus[iDeg][iOrd];
+          }
+        }
+      }
+      continue;
+    }
+    // satellite specific parameters
+    char sys = key.mid(0, 1).at(0).toLatin1();
+    int number = key.mid(1, 2).toInt();
+    int flags = 0;
+    if (sys == 'E') { // I/NAV
+      flags = 1;
+    }
+    prn.set(sys, number, flags);
+    QString prnInternalStr = QString::fromStdString(prn.toInternalString());
+
+    const t_eph* ephLast = _ephUser->ephLast(prn);
+    const t_eph* ephPrev = _ephUser->ephPrev(prn);
+    const t_eph* eph = ephLast;
+    if (eph) {
+
+      // Use previous ephemeris if the last one is too recent
+      // ----------------------------------------------------
+      const int MINAGE = 60; // seconds
+      if (ephPrev && eph->receptDateTime().isValid()
+          && eph->receptDateTime().secsTo(currentDateAndTimeGPS()) < MINAGE) {
+        eph = ephPrev;
+      }
+
+      // Make sure the clock messages refer to same IOD as orbit messages
+      // ----------------------------------------------------------------
+      if (_usedEph) {
+        if (fmod(epoTime.gpssec(), _samplRtcmEphCorr) == 0.0) {
+          (*_usedEph)[prnInternalStr] = eph;
+        }
+        else {
+          eph = 0;
+          if (_usedEph->contains(prnInternalStr)) {
+            const t_eph* usedEph = _usedEph->value(prnInternalStr);
+            if (usedEph == ephLast) {
+              eph = ephLast;
+            }
+            else if (usedEph == ephPrev) {
+              eph = ephPrev;
+            }
+          }
+        }
+      }
+    }
+
+    if (eph) {
+
+      QMap<QString, double> codeBiases;
+      QList<phaseBiasSignal> phaseBiasList;
+      phaseBiasesSat pbSat;
+
+      while (true) {
+        QString key;
+        int numVal = 0;
+        in >> key;
+        if (in.status() != QTextStream::Ok) {
+          break;
+        }
+        if (key == "APC") {
+          in >> numVal;
+          rtnAPC.ReSize(3);
+          for (int ii = 0; ii < numVal; ii++) {
+            //in >> rtnAPC[ii];
+              in >> rtnAPC(ii+1);
+          }
+        }
+        else if (key == "Clk") {
+          in >> numVal;
+          if (numVal == 1)
+            in >> rtnClk;
+        }
+        else if (key == "Vel") {
+          rtnVel.ReSize(3);
+          in >> numVal;
+          for (int ii = 0; ii < numVal; ii++) {
+            //in >> rtnVel[ii];
+              in >> rtnVel(ii+1);
+          }
+        }
+        else if (key == "CoM") {
+          rtnCoM.ReSize(3);
+          in >> numVal;
+          for (int ii = 0; ii < numVal; ii++) {
+            //in >> rtnCoM[ii];
+              in >> rtnCoM(ii+1);
+          }
+        }
+        else if (key == "CodeBias") {
+          in >> numVal;
+          for (int ii = 0; ii < numVal; ii++) {
+            QString type;
+            double value;
+            in >> type >> value;
+            codeBiases[type] = value;
+          }
+        }
+        else if (key == "YawAngle") {
+          in >> numVal >> pbSat.yawAngle;
+          if      (pbSat.yawAngle < 0.0) {
+            pbSat.yawAngle += (2*M_PI);
+          }
+          else if (pbSat.yawAngle > 2*M_PI) {
+            pbSat.yawAngle -= (2*M_PI);
+          }
+        }
+        else if (key == "YawRate") {
+          in >> numVal >> pbSat.yawRate;
+        }
+        else if (key == "PhaseBias") {
+          in >> numVal;
+          for (int ii = 0; ii < numVal; ii++) {
+            phaseBiasSignal pb;
+            in >> pb.type >> pb.bias >> pb.integerIndicator
+              >> pb.wlIndicator >> pb.discontinuityCounter;
+            phaseBiasList.append(pb);
+          }
+        }
+        else {
+          in >> numVal;
+          for (int ii = 0; ii < numVal; ii++) {
+            double dummy;
+            in >> dummy;
+          }
+        }
+      }
+
+      struct ClockOrbit::SatData* sd = 0;
+      if (prn.system() == 'G') {
+        sd = co.Sat + co.NumberOfSat[CLOCKORBIT_SATGPS];
+        ++co.NumberOfSat[CLOCKORBIT_SATGPS];
+      }
+      else if (prn.system() == 'R') {
+        sd = co.Sat + CLOCKORBIT_NUMGPS + co.NumberOfSat[CLOCKORBIT_SATGLONASS];
+        ++co.NumberOfSat[CLOCKORBIT_SATGLONASS];
+      }
+      else if (prn.system() == 'E') {
+        sd = co.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+            + co.NumberOfSat[CLOCKORBIT_SATGALILEO];
+        ++co.NumberOfSat[CLOCKORBIT_SATGALILEO];
+      }
+      else if (prn.system() == 'J') {
+        sd = co.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+            + CLOCKORBIT_NUMGALILEO + co.NumberOfSat[CLOCKORBIT_SATQZSS];
+        ++co.NumberOfSat[CLOCKORBIT_SATQZSS];
+      }
+      else if (prn.system() == 'S') {
+        sd = co.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+            + CLOCKORBIT_NUMGALILEO + CLOCKORBIT_NUMQZSS
+            + co.NumberOfSat[CLOCKORBIT_SATSBAS];
+        ++co.NumberOfSat[CLOCKORBIT_SATSBAS];
+      }
+      else if (prn.system() == 'C') {
+        sd = co.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+            + CLOCKORBIT_NUMGALILEO + CLOCKORBIT_NUMQZSS + CLOCKORBIT_NUMSBAS
+            + co.NumberOfSat[CLOCKORBIT_SATBDS];
+        ++co.NumberOfSat[CLOCKORBIT_SATBDS];
+      }
+      if (sd) {
+        sd->ID  = prn.number();
+        sd->IOD = eph->IOD();
+        bncRtnetEpoch::t_sat sat;
+        sat._prn    = prn;
+        sat._iSat   = sd - co.Sat;
+        sat._rtnAPC = rtnAPC;
+        sat._rtnClk = rtnClk;
+        sat._rtnVel = rtnVel;
+        sat._rtnCoM = rtnCoM;
+        sat._xB.ReSize(4);
+        sat._vB.ReSize(3);
+        eph->getCrd(epoTime, sat._xB, sat._vB, false);
+        epo._sats.push_back(sat);
+      }
+
+      // Code Biases
+      // -----------
+      struct CodeBias::BiasSat* biasSat = 0;
+      if (!codeBiases.isEmpty()) {
+        if (prn.system() == 'G') {
+          biasSat = bias.Sat + bias.NumberOfSat[CLOCKORBIT_SATGPS];
+          ++bias.NumberOfSat[CLOCKORBIT_SATGPS];
+        }
+        else if (prn.system() == 'R') {
+          biasSat = bias.Sat + CLOCKORBIT_NUMGPS
+              + bias.NumberOfSat[CLOCKORBIT_SATGLONASS];
+          ++bias.NumberOfSat[CLOCKORBIT_SATGLONASS];
+        }
+        else if (prn.system() == 'E') {
+          biasSat = bias.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+              + bias.NumberOfSat[CLOCKORBIT_SATGALILEO];
+          ++bias.NumberOfSat[CLOCKORBIT_SATGALILEO];
+        }
+        else if (prn.system() == 'J') {
+          biasSat = bias.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+              + CLOCKORBIT_NUMGALILEO + bias.NumberOfSat[CLOCKORBIT_SATQZSS];
+          ++bias.NumberOfSat[CLOCKORBIT_SATQZSS];
+        }
+        else if (prn.system() == 'S') {
+          biasSat = bias.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+              + CLOCKORBIT_NUMGALILEO + CLOCKORBIT_NUMQZSS
+              + bias.NumberOfSat[CLOCKORBIT_SATSBAS];
+          ++bias.NumberOfSat[CLOCKORBIT_SATSBAS];
+        }
+        else if (prn.system() == 'C') {
+          biasSat = bias.Sat + CLOCKORBIT_NUMGPS + CLOCKORBIT_NUMGLONASS
+              + CLOCKORBIT_NUMGALILEO + CLOCKORBIT_NUMQZSS + CLOCKORBIT_NUMSBAS
+              + bias.NumberOfSat[CLOCKORBIT_SATBDS];
+          ++bias.NumberOfSat[CLOCKORBIT_SATBDS];
+        }
+      }
+
+      if (biasSat) {
+        biasSat->ID = prn.number();
+        biasSat->NumberOfCodeBiases = 0;
+        if (prn.system() == 'G') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "1C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1S") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1C_D;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1L") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1C_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1C_DP;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1P") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1W") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L1_Z;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2D") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_SEMI_CODELESS;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2S") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_CM;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2L") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_CL;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_CML;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2P") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2W") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L2_Z;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L5_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L5_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGPS_L5_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+        else if (prn.system() == 'R') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "1C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGLONASS_L1_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1P") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGLONASS_L1_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGLONASS_L2_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2P") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGLONASS_L2_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+        else if (prn.system() == 'E') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "1A") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E1_A;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1B") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E1_B;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E1_C;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E1_BC;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1Z") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E1_ABC;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "8I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "8Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "8X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E5_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6A") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E6_A;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6B") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E6_B;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E6_C;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E6_BC;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6Z") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEGALILEO_E6_ABC;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+        else if (prn.system() == 'J') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "1C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L1_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1S") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L1C_D;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1L") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L1C_P;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "1X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L1C_DP;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2S") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L2C_M;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2L") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L2C_L;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L2C_ML;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L5_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L5_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_L5_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6S") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_LEX_S;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6L") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_LEX_L;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPEQZSS_LEX_SL;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+        else if (prn.system() == 'S') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "1C") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_SBAS_L1_CA;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_SBAS_L5_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_SBAS_L5_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "5X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_SBAS_L5_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+        else if (prn.system() == 'C') {
+          QMapIterator<QString, double> it(codeBiases);
+          while (it.hasNext()) {
+            it.next();
+            if (it.key() == "2I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B1_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B1_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "2X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B1_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B3_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B3_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "6X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B3_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7I") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B2_I;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7Q") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B2_Q;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+            else if (it.key() == "7X") {
+              int ii = biasSat->NumberOfCodeBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              biasSat->NumberOfCodeBiases += 1;
+              biasSat->Biases[ii].Type = CODETYPE_BDS_B2_IQ;
+              biasSat->Biases[ii].Bias = it.value();
+            }
+          }
+        }
+      }
+      // Phase Biases
+      // ------------
+      struct PhaseBias::PhaseBiasSat* phasebiasSat = 0;
+      if (!phaseBiasList.isEmpty()) {
+        if (prn.system() == 'G') {
+          phasebiasSat = phasebias.Sat
+              + phasebias.NumberOfSat[CLOCKORBIT_SATGPS];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATGPS];
+        }
+        else if (prn.system() == 'R') {
+          phasebiasSat = phasebias.Sat + CLOCKORBIT_NUMGPS
+              + phasebias.NumberOfSat[CLOCKORBIT_SATGLONASS];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATGLONASS];
+        }
+        else if (prn.system() == 'E') {
+          phasebiasSat = phasebias.Sat + CLOCKORBIT_NUMGPS
+              + CLOCKORBIT_NUMGLONASS
+              + phasebias.NumberOfSat[CLOCKORBIT_SATGALILEO];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATGALILEO];
+        }
+        else if (prn.system() == 'J') {
+          phasebiasSat = phasebias.Sat + CLOCKORBIT_NUMGPS
+              + CLOCKORBIT_NUMGLONASS + CLOCKORBIT_NUMGALILEO
+              + phasebias.NumberOfSat[CLOCKORBIT_SATQZSS];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATQZSS];
+        }
+        else if (prn.system() == 'S') {
+          phasebiasSat = phasebias.Sat + CLOCKORBIT_NUMGPS
+              + CLOCKORBIT_NUMGLONASS + CLOCKORBIT_NUMGALILEO
+              + CLOCKORBIT_NUMQZSS + phasebias.NumberOfSat[CLOCKORBIT_SATSBAS];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATSBAS];
+        }
+        else if (prn.system() == 'C') {
+          phasebiasSat = phasebias.Sat + CLOCKORBIT_NUMGPS
+              + CLOCKORBIT_NUMGLONASS + CLOCKORBIT_NUMGALILEO
+              + CLOCKORBIT_NUMQZSS + CLOCKORBIT_NUMSBAS
+              + phasebias.NumberOfSat[CLOCKORBIT_SATBDS];
+          ++phasebias.NumberOfSat[CLOCKORBIT_SATBDS];
+        }
+      }
+
+      if (phasebiasSat) {
+        phasebias.DispersiveBiasConsistencyIndicator = dispersiveBiasConsistenyIndicator;
+        phasebias.MWConsistencyIndicator = mwConsistencyIndicator;
+        phasebiasSat->ID = prn.number();
+        phasebiasSat->NumberOfPhaseBiases = 0;
+        phasebiasSat->YawAngle = pbSat.yawAngle;
+        phasebiasSat->YawRate = pbSat.yawRate;
+        if (prn.system() == 'G') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "1C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1S") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1C_D;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1L") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1C_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1C_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1P") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1W") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L1_Z;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2D") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_SEMI_CODELESS;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2S") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_CM;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2L") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_CL;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_CML;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2P") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2W") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L2_Z;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L5_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L5_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGPS_L5_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+        if (prn.system() == 'R') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "1C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGLONASS_L1_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1P") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGLONASS_L1_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGLONASS_L2_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2P") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGLONASS_L2_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+        if (prn.system() == 'E') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "1A") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E1_A;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1B") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E1_B;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E1_C;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E1_BC;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1Z") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E1_ABC;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5A_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5B_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "8I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "8Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "8X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E5_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6A") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E6_A;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6B") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E6_B;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E6_C;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E6_BC;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6Z") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEGALILEO_E6_ABC;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+        if (prn.system() == 'J') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "1C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L1_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1S") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L1C_D;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1L") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L1C_P;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "1X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L1C_DP;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2S") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L2C_M;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2L") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L2C_L;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L2C_ML;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L5_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L5_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_L5_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6S") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_LEX_S;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6L") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_LEX_L;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPEQZSS_LEX_SL;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+        if (prn.system() == 'S') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "1C") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_SBAS_L1_CA;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_SBAS_L5_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_SBAS_L5_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "5X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_SBAS_L5_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+        if (prn.system() == 'C') {
+          QListIterator<phaseBiasSignal> it(phaseBiasList);
+          while (it.hasNext()) {
+            const phaseBiasSignal &pbSig = it.next();
+            if (pbSig.type == "2I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B1_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B1_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "2X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B1_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B3_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B3_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "6X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B3_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7I") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B2_I;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7Q") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B2_Q;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+            else if (pbSig.type == "7X") {
+              int ii = phasebiasSat->NumberOfPhaseBiases;
+              if (ii >= CLOCKORBIT_NUMBIAS)
+                break;
+              phasebiasSat->NumberOfPhaseBiases += 1;
+              phasebiasSat->Biases[ii].Type = CODETYPE_BDS_B2_IQ;
+              phasebiasSat->Biases[ii].Bias = pbSig.bias;
+              phasebiasSat->Biases[ii].SignalIntegerIndicator = pbSig.integerIndicator;
+              phasebiasSat->Biases[ii].SignalsWideLaneIntegerIndicator =
+                  pbSig.wlIndicator;
+              phasebiasSat->Biases[ii].SignalDiscontinuityCounter =
+                  pbSig.discontinuityCounter;
+            }
+          }
+        }
+      }
+    }
+  }
+
+}
+
+// Update interval indicator of a sampling rate
+//////////////////////////////////////////////////////////////////////// 
+int bncRtnetDecoder::determineUpdateInd(double samplingRate) {
+
+  if (samplingRate == 10.0) {
+    return 3;
+  }
+  else if (samplingRate == 15.0) {
+    return 4;
+  }
+  else if (samplingRate == 30.0) {
+    return 5;
+  }
+  else if (samplingRate == 60.0) {
+    return 6;
+  }
+  else if (samplingRate == 120.0) {
+    return 7;
+  }
+  else if (samplingRate == 240.0) {
+    return 8;
+  }
+  else if (samplingRate == 300.0) {
+    return 9;
+  }
+  else if (samplingRate == 600.0) {
+    return 10;
+  }
+  else if (samplingRate == 900.0) {
+    return 11;
+  }
+  else if (samplingRate == 1800.0) {
+    return 12;
+  }
+  else if (samplingRate == 3600.0) {
+    return 13;
+  }
+  else if (samplingRate == 7200.0) {
+    return 14;
+  }
+  else if (samplingRate == 10800.0) {
+    return 15;
+  }
+  return 2;  // default
+}
@@ -30,6 +30,8 @@
 #include "bncrtnetuploadcaster.h"
 #include "GPSDecoder.h"
 
+class bncEphUser;
+
 class bncRtnetDecoder: public GPSDecoder {
  public:
   bncRtnetDecoder();
@@ -37,7 +39,15 @@ class bncRtnetDecoder: public GPSDecoder {
   virtual t_irc Decode(char* buffer, int bufLen, 
                        std::vector<std::string>& errmsg);
  private:
+  void decodeEpoch(const QStringList& lines, bncRtnetEpoch& epo);
+  int  determineUpdateInd(double samplingRate);
+
   QVector<bncRtnetUploadCaster*> _casters;
+  bncEphUser*                    _ephUser;
+  QString                        _rtnetStreamBuffer;
+  int                            _samplRtcmClkCorr;
+  double                         _samplRtcmEphCorr;
+  QMap<QString, const t_eph*>*   _usedEph;
 };
 
 #endif  // include blocker
@@ -9,11 +9,40 @@ extern "C" {
 #include "clock_orbit_rtcm.h"
 }
 
-class bncEphUser;
 class bncoutf;
 class bncClockRinex;
 class bncSP3;
 
+// One RTNET epoch, decoded once by bncRtnetDecoder and shared by all
+// upload casters. The SSR structures hold everything that does not depend
+// on the caster (satellite slots, IODs, biases, VTEC).
+class bncRtnetEpoch {
+ public:
+  class t_sat {
+   public:
+    t_sat() {
+      _iSat   = 0;
+      _rtnClk = 0.0;
+    }
+    t_prn                _prn;
+    int                  _iSat;    // index of the satellite in _co.Sat
+    NEWMAT::ColumnVector _rtnAPC;
+    NEWMAT::ColumnVector _rtnVel;
+    NEWMAT::ColumnVector _rtnCoM;
+    double               _rtnClk;
+    NEWMAT::ColumnVector _xB;      // broadcast position and clock
+    NEWMAT::ColumnVector _vB;      // broadcast velocity
+  };
+  bncTime            _time;
+  int                _clkUpdInd;
+  int                _ephUpdInd;
+  QVector<t_sat>     _sats;
+  struct ClockOrbit  _co;
+  struct CodeBias    _bias;
+  struct PhaseBias   _phasebias;
+  struct VTEC        _vtec;
+};
+
 class bncRtnetUploadCaster : public bncUploadCaster {
  Q_OBJECT
  public:
@@ -24,31 +53,20 @@ class bncRtnetUploadCaster : public bncUploadCaster {
                   const QString& sp3FileName,
                   const QString& rnxFileName,
                   int PID, int SID, int IOD, int iRow);
-  void decodeRtnetStream(char* buffer, int bufLen);
+  void processRtnetEpoch(const bncRtnetEpoch& epo);
  protected:
   virtual ~bncRtnetUploadCaster();
  private:
-  void processSatellite(const t_eph* eph, int GPSweek, 
-                        double GPSweeks, const QString& prn, 
-                        const NEWMAT::ColumnVector& rtnAPC,
-                        double rtnClk,
-                        const NEWMAT::ColumnVector& rtnVel,
-                        const NEWMAT::ColumnVector& rtnCoM,
-                        struct ClockOrbit::SatData* sd,
-                        QString& outLine);
+  void processSatellite(const bncRtnetEpoch::t_sat& sat, int GPSweek,
+                        double GPSweeks, struct ClockOrbit::SatData* sd);
   void crdTrafo(int GPSWeek, NEWMAT::ColumnVector& xyz, double& dc);
 
-  int determineUpdateInd(double samplingRate);
-
   QString        _casterID;
-  bncEphUser*    _ephUser;
-  QString        _rtnetStreamBuffer;
   QString        _crdTrafo;
   bool           _CoM;
   int            _PID;
   int            _SID;
   int            _IOD;
-  int            _samplRtcmClkCorr;
   double         _samplRtcmEphCorr;
   double         _dx;
   double         _dy;
@@ -67,7 +85,6 @@ class bncRtnetUploadCaster : public bncUploadCaster {
   double         _t0;
   bncClockRinex* _rnx;
   bncSP3*        _sp3;
-  QMap<QString, const t_eph*>* _usedEph;
 };
 
 struct phaseBiasesSat {